@@ -0,0 +1,196 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Benchmark/StageBenchmarkReport.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogStageBenchmark, Log, All);
+
+namespace
+{
+	struct FMetricStats
+	{
+		double MinMs = 0.0;
+		double MaxMs = 0.0;
+		double MeanMs = 0.0;
+		double MedianMs = 0.0;
+		double TotalMs = 0.0;
+	};
+
+	FMetricStats ComputeStats(TArray<double> Samples)
+	{
+		FMetricStats Stats;
+		if (Samples.Num() == 0)
+		{
+			return Stats;
+		}
+
+		Samples.Sort();
+		Stats.MinMs = Samples[0];
+		Stats.MaxMs = Samples.Last();
+		for (double Sample : Samples)
+		{
+			Stats.TotalMs += Sample;
+		}
+		Stats.MeanMs = Stats.TotalMs / Samples.Num();
+		Stats.MedianMs = (Samples.Num() % 2 == 1)
+			? Samples[Samples.Num() / 2]
+			: 0.5 * (Samples[Samples.Num() / 2 - 1] + Samples[Samples.Num() / 2]);
+		return Stats;
+	}
+
+	double ToMegabytes(uint64 Bytes)
+	{
+		return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+	}
+}
+
+FStageBenchmarkReport::FStageBenchmarkReport(const FString& InSuiteName)
+	: SuiteName(InSuiteName)
+	, StartTime(FDateTime::UtcNow())
+{
+}
+
+void FStageBenchmarkReport::SetParameter(const FString& Key, int32 Value)
+{
+	Parameters.Emplace(Key, Value);
+}
+
+void FStageBenchmarkReport::AddSample(const FString& MetricName, double Milliseconds, int32 OpsPerSample)
+{
+	FMetric* Metric = Metrics.FindByPredicate([&MetricName](const FMetric& Existing)
+	{
+		return Existing.Name == MetricName;
+	});
+
+	if (!Metric)
+	{
+		Metric = &Metrics.AddDefaulted_GetRef();
+		Metric->Name = MetricName;
+		Metric->OpsPerSample = FMath::Max(1, OpsPerSample);
+	}
+
+	Metric->SamplesMs.Add(Milliseconds);
+}
+
+void FStageBenchmarkReport::RecordMemory(const FString& Label)
+{
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+
+	FMemorySnapshot& Snapshot = MemorySnapshots.AddDefaulted_GetRef();
+	Snapshot.Label = Label;
+	Snapshot.UsedPhysical = MemoryStats.UsedPhysical;
+	Snapshot.PeakUsedPhysical = MemoryStats.PeakUsedPhysical;
+}
+
+bool FStageBenchmarkReport::WriteFiles(const FString& OutputBasePath) const
+{
+	//----------------------------------------------------------------
+	// JSON
+	//----------------------------------------------------------------
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("suite"), SuiteName);
+	Root->SetStringField(TEXT("timestamp"), StartTime.ToIso8601());
+	Root->SetStringField(TEXT("buildVersion"), FApp::GetBuildVersion());
+	Root->SetStringField(TEXT("buildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+
+	TSharedRef<FJsonObject> ParametersObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, int32>& Parameter : Parameters)
+	{
+		ParametersObject->SetNumberField(Parameter.Key, Parameter.Value);
+	}
+	Root->SetObjectField(TEXT("parameters"), ParametersObject);
+
+	TArray<TSharedPtr<FJsonValue>> MetricValues;
+	for (const FMetric& Metric : Metrics)
+	{
+		const FMetricStats Stats = ComputeStats(Metric.SamplesMs);
+
+		TSharedRef<FJsonObject> MetricObject = MakeShared<FJsonObject>();
+		MetricObject->SetStringField(TEXT("name"), Metric.Name);
+		MetricObject->SetNumberField(TEXT("samples"), Metric.SamplesMs.Num());
+		MetricObject->SetNumberField(TEXT("opsPerSample"), Metric.OpsPerSample);
+		MetricObject->SetNumberField(TEXT("minMs"), Stats.MinMs);
+		MetricObject->SetNumberField(TEXT("medianMs"), Stats.MedianMs);
+		MetricObject->SetNumberField(TEXT("meanMs"), Stats.MeanMs);
+		MetricObject->SetNumberField(TEXT("maxMs"), Stats.MaxMs);
+		MetricObject->SetNumberField(TEXT("totalMs"), Stats.TotalMs);
+		MetricObject->SetNumberField(TEXT("usPerOp"), Stats.MedianMs * 1000.0 / Metric.OpsPerSample);
+		MetricValues.Add(MakeShared<FJsonValueObject>(MetricObject));
+	}
+	Root->SetArrayField(TEXT("metrics"), MetricValues);
+
+	TArray<TSharedPtr<FJsonValue>> MemoryValues;
+	for (const FMemorySnapshot& Snapshot : MemorySnapshots)
+	{
+		TSharedRef<FJsonObject> MemoryObject = MakeShared<FJsonObject>();
+		MemoryObject->SetStringField(TEXT("label"), Snapshot.Label);
+		MemoryObject->SetNumberField(TEXT("usedPhysicalMB"), ToMegabytes(Snapshot.UsedPhysical));
+		MemoryObject->SetNumberField(TEXT("peakUsedPhysicalMB"), ToMegabytes(Snapshot.PeakUsedPhysical));
+		MemoryValues.Add(MakeShared<FJsonValueObject>(MemoryObject));
+	}
+	Root->SetArrayField(TEXT("memory"), MemoryValues);
+
+	FString JsonText;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonText);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	//----------------------------------------------------------------
+	// CSV (one row per metric)
+	//----------------------------------------------------------------
+
+	FString CsvText = TEXT("suite,metric,samples,ops_per_sample,min_ms,median_ms,mean_ms,max_ms,us_per_op\n");
+	for (const FMetric& Metric : Metrics)
+	{
+		const FMetricStats Stats = ComputeStats(Metric.SamplesMs);
+		CsvText += FString::Printf(TEXT("%s,%s,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f\n"),
+			*SuiteName, *Metric.Name, Metric.SamplesMs.Num(), Metric.OpsPerSample,
+			Stats.MinMs, Stats.MedianMs, Stats.MeanMs, Stats.MaxMs,
+			Stats.MedianMs * 1000.0 / Metric.OpsPerSample);
+	}
+
+	const FString JsonPath = OutputBasePath + TEXT(".json");
+	const FString CsvPath = OutputBasePath + TEXT(".csv");
+	const bool bJsonWritten = FFileHelper::SaveStringToFile(JsonText, *JsonPath);
+	const bool bCsvWritten = FFileHelper::SaveStringToFile(CsvText, *CsvPath);
+
+	if (bJsonWritten && bCsvWritten)
+	{
+		UE_LOG(LogStageBenchmark, Display, TEXT("Benchmark results written to %s(.json|.csv)"), *OutputBasePath);
+	}
+	else
+	{
+		UE_LOG(LogStageBenchmark, Error, TEXT("Failed to write benchmark results to %s"), *OutputBasePath);
+	}
+
+	return bJsonWritten && bCsvWritten;
+}
+
+void FStageBenchmarkReport::LogSummary() const
+{
+	UE_LOG(LogStageBenchmark, Display, TEXT("=== %s ==="), *SuiteName);
+	for (const FMetric& Metric : Metrics)
+	{
+		const FMetricStats Stats = ComputeStats(Metric.SamplesMs);
+		UE_LOG(LogStageBenchmark, Display, TEXT("  %-40s median %10.3f ms  (min %.3f, max %.3f, n=%d, %.3f us/op)"),
+			*Metric.Name, Stats.MedianMs, Stats.MinMs, Stats.MaxMs, Metric.SamplesMs.Num(),
+			Stats.MedianMs * 1000.0 / Metric.OpsPerSample);
+	}
+	for (const FMemorySnapshot& Snapshot : MemorySnapshots)
+	{
+		UE_LOG(LogStageBenchmark, Display, TEXT("  Memory [%s]: used %.1f MB, peak %.1f MB"),
+			*Snapshot.Label, ToMegabytes(Snapshot.UsedPhysical), ToMegabytes(Snapshot.PeakUsedPhysical));
+	}
+}
+
+FString FStageBenchmarkReport::GetDefaultOutputBasePath() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"),
+		FString::Printf(TEXT("%s_%s"), *SuiteName, *StartTime.ToString(TEXT("%Y%m%d_%H%M%S"))));
+}
@@ -0,0 +1,91 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Benchmark 结果收集与输出（Stage 运行时/编辑器 Benchmark Commandlet 共用）
+ *
+ * 每个指标记录多次采样（毫秒），输出 JSON + CSV 两份机器可读文件，便于跨版本追踪回归。
+ */
+class FStageBenchmarkReport
+{
+public:
+	explicit FStageBenchmarkReport(const FString& InSuiteName);
+
+	/** 记录一个运行参数（写入 JSON 的 parameters 字段） */
+	void SetParameter(const FString& Key, int32 Value);
+
+	/**
+	 * 记录一次采样
+	 *
+	 * @param MetricName 指标名
+	 * @param Milliseconds 本次采样耗时
+	 * @param OpsPerSample 本次采样包含的操作数（用于计算 us/op）
+	 */
+	void AddSample(const FString& MetricName, double Milliseconds, int32 OpsPerSample = 1);
+
+	/** 记录当前/峰值物理内存快照 */
+	void RecordMemory(const FString& Label);
+
+	/**
+	 * 写出 <OutputBasePath>.json 与 <OutputBasePath>.csv
+	 *
+	 * @return 两个文件都写入成功
+	 */
+	bool WriteFiles(const FString& OutputBasePath) const;
+
+	/** 输出摘要到日志 */
+	void LogSummary() const;
+
+	/** 默认输出路径：Saved/Benchmarks/<Suite>_<时间戳>（不含扩展名） */
+	FString GetDefaultOutputBasePath() const;
+
+private:
+	struct FMetric
+	{
+		FString Name;
+		TArray<double> SamplesMs;
+		int32 OpsPerSample = 1;
+	};
+
+	struct FMemorySnapshot
+	{
+		FString Label;
+		uint64 UsedPhysical = 0;
+		uint64 PeakUsedPhysical = 0;
+	};
+
+	FString SuiteName;
+	FDateTime StartTime;
+	TArray<TPair<FString, int32>> Parameters;
+	TArray<FMetric> Metrics;
+	TArray<FMemorySnapshot> MemorySnapshots;
+};
+
+/**
+ * 作用域计时器：析构时向 Report 添加一次采样
+ */
+class FStageBenchmarkScope
+{
+public:
+	FStageBenchmarkScope(FStageBenchmarkReport& InReport, const FString& InMetricName, int32 InOpsPerSample = 1)
+		: Report(InReport)
+		, MetricName(InMetricName)
+		, OpsPerSample(InOpsPerSample)
+		, StartSeconds(FPlatformTime::Seconds())
+	{
+	}
+
+	~FStageBenchmarkScope()
+	{
+		Report.AddSample(MetricName, (FPlatformTime::Seconds() - StartSeconds) * 1000.0, OpsPerSample);
+	}
+
+private:
+	FStageBenchmarkReport& Report;
+	FString MetricName;
+	int32 OpsPerSample;
+	double StartSeconds;
+};
@@ -0,0 +1,399 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Benchmark/StageEditorBenchmarkCommandlet.h"
+#include "Benchmark/StageBenchmarkReport.h"
+#include "StageEditorModule.h"
+#include "Actors/Stage.h"
+#include "DataLayerSync/DataLayerImporter.h"
+#include "DataLayerSync/DataLayerSyncStatus.h"
+#include "DataLayerSync/DataLayerSynchronizer.h"
+#include "DataLayerSync/StageDataLayerNameParser.h"
+#include "EditorUI/StageEditorPanel.h"
+#include "DataLayer/DataLayerEditorSubsystem.h"
+#include "WorldPartition/DataLayer/DataLayerAsset.h"
+#include "WorldPartition/DataLayer/DataLayerInstance.h"
+#include "WorldPartition/DataLayer/WorldDataLayers.h"
+#include "Components/StageEntityComponent.h"
+#include "Components/StageEntityRefreshQueue.h"
+#include "Subsystems/StageManagerSubsystem.h"
+#include "Editor.h"
+#include "FileHelpers.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogStageEditorBenchmark, Log, All);
+
+UStageEditorBenchmarkCommandlet::UStageEditorBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UStageEditorBenchmarkCommandlet::Main(const FString& Params)
+{
+	FParse::Value(*Params, TEXT("StageLayers="), NumStageLayers);
+	FParse::Value(*Params, TEXT("ActsPerStage="), NumActsPerStage);
+	FParse::Value(*Params, TEXT("ActorsPerAct="), NumActorsPerAct);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+
+	NumStageLayers = FMath::Max(1, NumStageLayers);
+	NumActsPerStage = FMath::Max(1, NumActsPerStage);
+	NumActorsPerAct = FMath::Max(1, NumActorsPerAct);
+	NumIterations = FMath::Max(1, NumIterations);
+
+	FStageBenchmarkReport Report(TEXT("StageEditor"));
+	Report.SetParameter(TEXT("StageLayers"), NumStageLayers);
+	Report.SetParameter(TEXT("ActsPerStage"), NumActsPerStage);
+	Report.SetParameter(TEXT("ActorsPerAct"), NumActorsPerAct);
+	Report.SetParameter(TEXT("Iterations"), NumIterations);
+
+	FString OutputBasePath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputBasePath))
+	{
+		OutputBasePath = Report.GetDefaultOutputBasePath();
+	}
+
+	UE_LOG(LogStageEditorBenchmark, Display, TEXT("Stage editor benchmark: %d Stage DataLayers x %d Acts x %d Actors, %d iterations"),
+		NumStageLayers, NumActsPerStage, NumActorsPerAct, NumIterations);
+
+	Report.RecordMemory(TEXT("Start"));
+
+	UWorld* World = GenerateBenchmarkMap();
+	if (!World)
+	{
+		UE_LOG(LogStageEditorBenchmark, Error, TEXT("Failed to create World Partition benchmark map"));
+		return 1;
+	}
+
+	Report.RecordMemory(TEXT("MapGenerated"));
+
+	RunGeneratePreviewBenchmark(World, Report);
+	bool bValid = RunImportBenchmark(World, Report);
+	Report.RecordMemory(TEXT("Imported"));
+
+	if (bValid)
+	{
+		RunDetectStatusBenchmark(Report);
+		bValid = RunSyncAllBenchmark(World, Report);
+		Report.RecordMemory(TEXT("Synced"));
+	}
+
+	if (bValid)
+	{
+		RunRefreshUIBenchmark(Report);
+		Report.RecordMemory(TEXT("End"));
+	}
+
+	// Entity registration queues editor refreshes; drop them before the map goes away
+	FStageEntityRefreshQueue::Get().Flush();
+
+	StageAssets.Reset();
+	ActInstancesPerStage.Reset();
+
+	Report.LogSummary();
+	const bool bWritten = Report.WriteFiles(OutputBasePath);
+	return bValid && bWritten ? 0 : 1;
+}
+
+//----------------------------------------------------------------
+// Map Generation
+//----------------------------------------------------------------
+
+UWorld* UStageEditorBenchmarkCommandlet::GenerateBenchmarkMap()
+{
+	if (!GEditor)
+	{
+		return nullptr;
+	}
+
+	// DetectStatus/SyncAllOutOfSync resolve the editor world context, so the map must be the editor world
+	UWorld* World = GEditor->NewMap(/*bIsPartitionedWorld=*/true);
+	if (!World || !World->GetWorldDataLayers())
+	{
+		return nullptr;
+	}
+
+	StageAssets.Reset();
+	ActInstancesPerStage.Reset();
+
+	for (int32 StageIndex = 0; StageIndex < NumStageLayers; ++StageIndex)
+	{
+		const FString StageName = FString::Printf(TEXT("Bench%d"), StageIndex);
+		UDataLayerInstance* StageInstance = CreateDataLayer(World,
+			FStageDataLayerNameParser::MakeStageDataLayerName(StageName), nullptr);
+		if (!StageInstance)
+		{
+			continue;
+		}
+
+		StageAssets.Add(const_cast<UDataLayerAsset*>(StageInstance->GetAsset()));
+		TArray<UDataLayerInstance*>& ActInstances = ActInstancesPerStage.AddDefaulted_GetRef();
+
+		for (int32 ActIndex = 0; ActIndex < NumActsPerStage; ++ActIndex)
+		{
+			const FString ActName = FString::Printf(TEXT("Act%d"), ActIndex);
+			UDataLayerInstance* ActInstance = CreateDataLayer(World,
+				FStageDataLayerNameParser::MakeActDataLayerName(StageName, ActName), StageInstance);
+			if (!ActInstance)
+			{
+				continue;
+			}
+
+			ActInstances.Add(ActInstance);
+			SpawnMemberActors(World, ActInstance, NumActorsPerAct, FVector(StageIndex * 10000.0, ActIndex * 1000.0, 0.0));
+		}
+	}
+
+	return World;
+}
+
+UDataLayerInstance* UStageEditorBenchmarkCommandlet::CreateDataLayer(UWorld* World, const FString& Name, UDataLayerInstance* ParentInstance)
+{
+	UDataLayerEditorSubsystem* DataLayerSubsystem = UDataLayerEditorSubsystem::Get();
+	if (!DataLayerSubsystem)
+	{
+		return nullptr;
+	}
+
+	UDataLayerAsset* Asset = NewObject<UDataLayerAsset>(GetTransientPackage(), FName(*Name), RF_Transactional);
+
+	FDataLayerCreationParameters CreationParams;
+	CreationParams.DataLayerAsset = Asset;
+	CreationParams.WorldDataLayers = World->GetWorldDataLayers();
+
+	UDataLayerInstance* Instance = DataLayerSubsystem->CreateDataLayerInstance(CreationParams);
+	if (Instance && ParentInstance)
+	{
+		DataLayerSubsystem->SetParentDataLayer(Instance, ParentInstance);
+	}
+	return Instance;
+}
+
+void UStageEditorBenchmarkCommandlet::SpawnMemberActors(UWorld* World, UDataLayerInstance* Instance, int32 Count, const FVector& Origin)
+{
+	UDataLayerEditorSubsystem* DataLayerSubsystem = UDataLayerEditorSubsystem::Get();
+	if (!DataLayerSubsystem)
+	{
+		return;
+	}
+
+	TArray<AActor*> Actors;
+	Actors.Reserve(Count);
+	for (int32 ActorIndex = 0; ActorIndex < Count; ++ActorIndex)
+	{
+		const FVector Location = Origin + FVector(0.0, 0.0, ActorIndex * 100.0);
+		if (AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location)))
+		{
+			// AStage::AllocateEntity rejects actors without an Entity component
+			UStageEntityComponent* EntityComp = NewObject<UStageEntityComponent>(Actor, TEXT("StageEntityComponent"));
+			Actor->AddInstanceComponent(EntityComp);
+			EntityComp->RegisterComponent();
+			Actors.Add(Actor);
+		}
+	}
+
+	DataLayerSubsystem->AddActorsToDataLayer(Actors, Instance);
+}
+
+void UStageEditorBenchmarkCommandlet::DirtyImportedStages(UWorld* World, int32 ActorsPerStage)
+{
+	for (int32 StageIndex = 0; StageIndex < ActInstancesPerStage.Num(); ++StageIndex)
+	{
+		if (ActInstancesPerStage[StageIndex].Num() > 0)
+		{
+			SpawnMemberActors(World, ActInstancesPerStage[StageIndex][0], ActorsPerStage, FVector(StageIndex * 10000.0, -1000.0, 0.0));
+		}
+	}
+}
+
+//----------------------------------------------------------------
+// Benchmarks
+//----------------------------------------------------------------
+
+void UStageEditorBenchmarkCommandlet::RunGeneratePreviewBenchmark(UWorld* World, FStageBenchmarkReport& Report)
+{
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (UDataLayerAsset* StageAsset : StageAssets)
+		{
+			FStageBenchmarkScope Scope(Report, TEXT("GeneratePreview"), NumActsPerStage * NumActorsPerAct);
+			FDataLayerImporter::GeneratePreview(StageAsset, World);
+		}
+	}
+}
+
+int32 UStageEditorBenchmarkCommandlet::CountRegisteredEntities(UWorld* World) const
+{
+	UStageManagerSubsystem* Subsystem = World ? World->GetSubsystem<UStageManagerSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		return 0;
+	}
+
+	int32 Count = 0;
+	for (UDataLayerAsset* StageAsset : StageAssets)
+	{
+		if (const AStage* Stage = Subsystem->FindStageByDataLayer(StageAsset))
+		{
+			Count += Stage->GetEntityCount();
+		}
+	}
+	return Count;
+}
+
+int32 UStageEditorBenchmarkCommandlet::CountRowsNotSynced() const
+{
+	int32 NotSynced = 0;
+	for (int32 StageIndex = 0; StageIndex < StageAssets.Num(); ++StageIndex)
+	{
+		auto CheckRow = [&NotSynced](const UDataLayerAsset* Asset)
+		{
+			const FDataLayerSyncStatusInfo Info = FDataLayerSyncStatusDetector::DetectStatus(Asset);
+			if (Info.Status != EDataLayerSyncStatus::Synced)
+			{
+				++NotSynced;
+				UE_LOG(LogStageEditorBenchmark, Warning, TEXT("'%s' is not Synced after SyncAllOutOfSync (+%d / -%d actors)"),
+					*Asset->GetName(), Info.AddedActorCount, Info.RemovedActorCount);
+			}
+		};
+
+		CheckRow(StageAssets[StageIndex]);
+		for (const UDataLayerInstance* ActInstance : ActInstancesPerStage[StageIndex])
+		{
+			CheckRow(ActInstance->GetAsset());
+		}
+	}
+	return NotSynced;
+}
+
+bool UStageEditorBenchmarkCommandlet::RunImportBenchmark(UWorld* World, FStageBenchmarkReport& Report)
+{
+	// Import mutates the map, so every Stage DataLayer is imported exactly once
+	for (UDataLayerAsset* StageAsset : StageAssets)
+	{
+		FDataLayerImportParams ImportParams;
+		ImportParams.StageDataLayerAsset = StageAsset;
+		ImportParams.SelectedDefaultActIndex = 0;
+		ImportParams.StageBlueprintClass = AStage::StaticClass();
+
+		FDataLayerImportResult Result;
+		{
+			FStageBenchmarkScope Scope(Report, TEXT("ExecuteImport"), NumActsPerStage * NumActorsPerAct);
+			Result = FDataLayerImporter::ExecuteImport(ImportParams, World);
+		}
+
+		if (!Result.bSuccess)
+		{
+			UE_LOG(LogStageEditorBenchmark, Warning, TEXT("Import of '%s' failed: %s"),
+				*StageAsset->GetName(), *Result.ErrorMessage.ToString());
+		}
+	}
+
+	// Without registered Entities the timings only measure the rejection path
+	const int32 EntityCount = CountRegisteredEntities(World);
+	Report.SetParameter(TEXT("EntitiesAfterImport"), EntityCount);
+	if (EntityCount == 0)
+	{
+		UE_LOG(LogStageEditorBenchmark, Error, TEXT("No Entities were registered by ExecuteImport; aborting benchmark"));
+		return false;
+	}
+	return true;
+}
+
+void UStageEditorBenchmarkCommandlet::RunDetectStatusBenchmark(FStageBenchmarkReport& Report)
+{
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (int32 StageIndex = 0; StageIndex < StageAssets.Num(); ++StageIndex)
+		{
+			{
+				FStageBenchmarkScope Scope(Report, TEXT("DetectStatus.Stage"));
+				FDataLayerSyncStatusDetector::DetectStatus(StageAssets[StageIndex]);
+			}
+
+			for (UDataLayerInstance* ActInstance : ActInstancesPerStage[StageIndex])
+			{
+				FStageBenchmarkScope Scope(Report, TEXT("DetectStatus.Act"), NumActorsPerAct);
+				FDataLayerSyncStatusDetector::DetectStatus(ActInstance->GetAsset());
+			}
+		}
+	}
+}
+
+bool UStageEditorBenchmarkCommandlet::RunSyncAllBenchmark(UWorld* World, FStageBenchmarkReport& Report)
+{
+	const int32 AddedActorsPerStage = FMath::Max(1, NumActorsPerAct / 10);
+
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		DirtyImportedStages(World, AddedActorsPerStage);
+
+		FDataLayerBatchSyncResult Result;
+		{
+			FStageBenchmarkScope Scope(Report, TEXT("SyncAllOutOfSync"), StageAssets.Num());
+			Result = FDataLayerSynchronizer::SyncAllOutOfSync(World);
+		}
+
+		UE_LOG(LogStageEditorBenchmark, Verbose, TEXT("SyncAllOutOfSync: %d synced, %d failed, %d entity changes"),
+			Result.SyncedCount, Result.FailedCount, Result.TotalEntityChanges);
+
+		// Acts of one Stage must not undo each other: every row is Synced afterwards
+		if (const int32 NotSynced = CountRowsNotSynced())
+		{
+			UE_LOG(LogStageEditorBenchmark, Error, TEXT("%d DataLayer row(s) still out of sync after SyncAllOutOfSync"), NotSynced);
+			return false;
+		}
+	}
+
+	const int32 EntityCount = CountRegisteredEntities(World);
+	Report.SetParameter(TEXT("EntitiesAfterSync"), EntityCount);
+	if (EntityCount == 0)
+	{
+		UE_LOG(LogStageEditorBenchmark, Error, TEXT("No Entities are registered after SyncAllOutOfSync; benchmark results are invalid"));
+		return false;
+	}
+	return true;
+}
+
+void UStageEditorBenchmarkCommandlet::RunRefreshUIBenchmark(FStageBenchmarkReport& Report)
+{
+	if (!FSlateApplication::IsInitialized())
+	{
+		UE_LOG(LogStageEditorBenchmark, Display, TEXT("Slate is not initialized; skipping RefreshUI (run Stage.Benchmark.Editor in the editor to include it)"));
+		return;
+	}
+
+	TSharedRef<SStageEditorPanel> Panel = SNew(SStageEditorPanel, FStageEditorModule::Get().GetController());
+
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		FStageBenchmarkScope Scope(Report, TEXT("RefreshUI"), StageAssets.Num());
+		Panel->RefreshUI();
+	}
+}
+
+//----------------------------------------------------------------
+// Console Command
+//----------------------------------------------------------------
+
+static FAutoConsoleCommand StageEditorBenchmarkCommand(
+	TEXT("Stage.Benchmark.Editor"),
+	TEXT("Run the Stage editor DataLayer benchmark in a new World Partition map. Usage: Stage.Benchmark.Editor [StageLayers=N] [ActsPerStage=N] [ActorsPerAct=N] [Iterations=N] [Output=Path]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		// The benchmark replaces the current map; give the user a chance to save first
+		if (!FEditorFileUtils::SaveDirtyPackages(/*bPromptUserToSave=*/true, /*bSaveMapPackages=*/true, /*bSaveContentPackages=*/true))
+		{
+			UE_LOG(LogStageEditorBenchmark, Display, TEXT("Stage editor benchmark cancelled"));
+			return;
+		}
+
+		UStageEditorBenchmarkCommandlet* Benchmark = NewObject<UStageEditorBenchmarkCommandlet>();
+		Benchmark->AddToRoot();
+		Benchmark->Main(FString::Join(Args, TEXT(" ")));
+		Benchmark->RemoveFromRoot();
+	})
+);
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "StageEditorBenchmarkCommandlet.generated.h"
+
+class UDataLayerAsset;
+class UDataLayerInstance;
+class UWorld;
+class FStageBenchmarkReport;
+
+/**
+ * Stage 编辑器 DataLayer 工作流 Benchmark Commandlet
+ *
+ * 新建一个 World Partition 编辑器地图，程序化生成 N 个 DL_Stage_ × M 个 DL_Act_ DataLayer
+ * 以及每个 Act K 个成员 Actor，计时 GeneratePreview、ExecuteImport、DetectStatus、
+ * SyncAllOutOfSync 与 SStageEditorPanel::RefreshUI，输出 JSON/CSV（含峰值内存）。
+ *
+ * 用法:
+ *   UnrealEditor-Cmd <Project> -run=StageEditorBenchmark -unattended
+ *     [-StageLayers=10] [-ActsPerStage=8] [-ActorsPerAct=50] [-Iterations=5] [-Output=<路径，不含扩展名>]
+ *
+ * 说明:
+ * - Commandlet 模式下 Slate 未初始化，RefreshUI 指标会被跳过；
+ *   在编辑器中执行控制台命令 Stage.Benchmark.Editor [同上参数] 可得到包含 RefreshUI 的完整结果
+ *   （会替换当前关卡，执行前提示保存）
+ * - DataLayer Asset 创建在 Transient 包中，不写入项目内容
+ * - 每轮 SyncAllOutOfSync 后校验所有 Stage / Act 行均为 Synced，且导入/同步后 Entity 数不为 0，否则运行失败
+ */
+UCLASS()
+class UStageEditorBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UStageEditorBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** 新建 World Partition 编辑器地图并生成 DataLayer 层级与成员 Actor */
+	UWorld* GenerateBenchmarkMap();
+
+	/** 创建一个 Transient DataLayer Asset 及其 Instance */
+	UDataLayerInstance* CreateDataLayer(UWorld* World, const FString& Name, UDataLayerInstance* ParentInstance);
+
+	/** 生成 Count 个带 UStageEntityComponent 的 Actor 并加入指定 DataLayer（否则无法注册为 Entity） */
+	void SpawnMemberActors(UWorld* World, UDataLayerInstance* Instance, int32 Count, const FVector& Origin);
+
+	/** 给每个 Stage 的第一个 Act DataLayer 追加 Actor，使 Stage 变为 OutOfSync */
+	void DirtyImportedStages(UWorld* World, int32 ActorsPerStage);
+
+	void RunGeneratePreviewBenchmark(UWorld* World, FStageBenchmarkReport& Report);
+	/** @return false 表示导入后没有注册任何 Entity（计时无意义） */
+	bool RunImportBenchmark(UWorld* World, FStageBenchmarkReport& Report);
+	void RunDetectStatusBenchmark(FStageBenchmarkReport& Report);
+	/** @return false 表示同步后没有注册任何 Entity（计时无意义） */
+	bool RunSyncAllBenchmark(UWorld* World, FStageBenchmarkReport& Report);
+	void RunRefreshUIBenchmark(FStageBenchmarkReport& Report);
+
+	/** 已导入 Stage 的 Entity 总数 */
+	int32 CountRegisteredEntities(UWorld* World) const;
+
+	/**
+	 * SyncAllOutOfSync 之后每个 Stage / Act 行都应为 Synced（多 Act 共享 Stage 时验证注销规则一致）
+	 * @return 未同步的行数
+	 */
+	int32 CountRowsNotSynced() const;
+
+	int32 NumStageLayers = 10;
+	int32 NumActsPerStage = 8;
+	int32 NumActorsPerAct = 50;
+	int32 NumIterations = 5;
+
+	/** 生成的 Stage DataLayer 及对应的 Act DataLayer（与生成顺序一致） */
+	TArray<UDataLayerAsset*> StageAssets;
+	TArray<TArray<UDataLayerInstance*>> ActInstancesPerStage;
+};
@@ -0,0 +1,346 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Benchmark/StageRuntimeBenchmarkCommandlet.h"
+#include "Benchmark/StageBenchmarkReport.h"
+#include "Actors/Stage.h"
+#include "Components/StageEntityComponent.h"
+#include "Components/StageEntityRefreshQueue.h"
+#include "Components/StageTriggerZoneComponent.h"
+#include "Core/StageStreamingSettings.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/Parse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogStageRuntimeBenchmark, Log, All);
+
+UStageRuntimeBenchmarkCommandlet::UStageRuntimeBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UStageRuntimeBenchmarkCommandlet::Main(const FString& Params)
+{
+	FParse::Value(*Params, TEXT("Stages="), NumStages);
+	FParse::Value(*Params, TEXT("Acts="), NumActs);
+	FParse::Value(*Params, TEXT("Entities="), NumEntities);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	FParse::Value(*Params, TEXT("Pawns="), NumPawns);
+
+	NumStages = FMath::Max(1, NumStages);
+	NumActs = FMath::Max(1, NumActs);
+	NumEntities = FMath::Max(1, NumEntities);
+	NumIterations = FMath::Max(1, NumIterations);
+	NumPawns = FMath::Max(1, NumPawns);
+
+	FStageBenchmarkReport Report(TEXT("StageRuntime"));
+	Report.SetParameter(TEXT("Stages"), NumStages);
+	Report.SetParameter(TEXT("Acts"), NumActs);
+	Report.SetParameter(TEXT("Entities"), NumEntities);
+	Report.SetParameter(TEXT("Iterations"), NumIterations);
+	Report.SetParameter(TEXT("Pawns"), NumPawns);
+
+	FString OutputBasePath;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputBasePath))
+	{
+		OutputBasePath = Report.GetDefaultOutputBasePath();
+	}
+
+	UE_LOG(LogStageRuntimeBenchmark, Display, TEXT("Stage runtime benchmark: %d Stages x %d Acts x %d Entities, %d iterations"),
+		NumStages, NumActs, NumEntities, NumIterations);
+
+	// The benchmark world is never ticked: with the scheduler on, Preloading would wait forever for a
+	// next-tick load slot. Dispatch loads synchronously for this run (restored below).
+	UStageStreamingSettings* StreamingSettings = UStageStreamingSettings::Get();
+	const bool bPrevEnableStreamingScheduler = StreamingSettings->bEnableStreamingScheduler;
+	StreamingSettings->bEnableStreamingScheduler = false;
+	Report.SetParameter(TEXT("StreamingScheduler"), 0);
+
+	UWorld* World = CreateBenchmarkWorld();
+	if (!World)
+	{
+		UE_LOG(LogStageRuntimeBenchmark, Error, TEXT("Failed to create benchmark world"));
+		StreamingSettings->bEnableStreamingScheduler = bPrevEnableStreamingScheduler;
+		return 1;
+	}
+
+	Report.RecordMemory(TEXT("Start"));
+
+	TArray<AStage*> Stages;
+	for (int32 StageIndex = 0; StageIndex < NumStages; ++StageIndex)
+	{
+		if (AStage* Stage = BuildStage(World, StageIndex, Report))
+		{
+			Stages.Add(Stage);
+		}
+	}
+
+	Report.RecordMemory(TEXT("WorldGenerated"));
+
+	RunActivateActBenchmark(Stages, Report);
+	RunEffectiveStateBenchmark(Stages, Report);
+	RunStageCycleBenchmark(Stages, Report);
+	RunOverlapStormBenchmark(World, Stages, Report);
+
+	Report.RecordMemory(TEXT("End"));
+
+	DestroyBenchmarkWorld(World);
+	StreamingSettings->bEnableStreamingScheduler = bPrevEnableStreamingScheduler;
+
+	Report.LogSummary();
+	return Report.WriteFiles(OutputBasePath) ? 0 : 1;
+}
+
+//----------------------------------------------------------------
+// World Generation
+//----------------------------------------------------------------
+
+UWorld* UStageRuntimeBenchmarkCommandlet::CreateBenchmarkWorld()
+{
+	if (!GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("StageRuntimeBenchmark"));
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+	return World;
+}
+
+void UStageRuntimeBenchmarkCommandlet::DestroyBenchmarkWorld(UWorld* World)
+{
+	// Entity state changes queue editor refreshes; drop them before the actors go away
+	FStageEntityRefreshQueue::Get().Shutdown();
+
+	if (GEngine)
+	{
+		GEngine->DestroyWorldContext(World);
+	}
+	World->DestroyWorld(false);
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+AActor* UStageRuntimeBenchmarkCommandlet::SpawnEntityActor(UWorld* World)
+{
+	AActor* Actor = World->SpawnActor<AActor>();
+	if (!Actor)
+	{
+		return nullptr;
+	}
+
+	UStageEntityComponent* EntityComp = NewObject<UStageEntityComponent>(Actor, TEXT("StageEntityComponent"));
+	Actor->AddInstanceComponent(EntityComp);
+	EntityComp->RegisterComponent();
+	return Actor;
+}
+
+AStage* UStageRuntimeBenchmarkCommandlet::BuildStage(UWorld* World, int32 StageIndex, FStageBenchmarkReport& Report)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Name = *FString::Printf(TEXT("BenchmarkStage_%d"), StageIndex);
+	AStage* Stage = World->SpawnActor<AStage>(FVector(StageIndex * 10000.0, 0.0, 0.0), FRotator::ZeroRotator, SpawnParams);
+	if (!Stage)
+	{
+		return nullptr;
+	}
+
+	// No ticking in the benchmark world, so a debounced unload would never fire: unload immediately
+	Stage->UnloadDelay = 0.0f;
+	Stage->UnloadExtentPadding = 0.0f;
+
+	TArray<AActor*> EntityActors;
+	EntityActors.Reserve(NumEntities);
+	for (int32 EntityIndex = 0; EntityIndex < NumEntities; ++EntityIndex)
+	{
+		if (AActor* EntityActor = SpawnEntityActor(World))
+		{
+			EntityActors.Add(EntityActor);
+		}
+	}
+
+	// Even Stages: one-by-one; odd Stages: bulk
+	TArray<int32> EntityIDs;
+	if (StageIndex % 2 == 0)
+	{
+		FStageBenchmarkScope Scope(Report, TEXT("RegisterEntity"), EntityActors.Num());
+		EntityIDs.Reserve(EntityActors.Num());
+		for (AActor* EntityActor : EntityActors)
+		{
+			EntityIDs.Add(Stage->RegisterEntity(EntityActor));
+		}
+	}
+	else
+	{
+		FStageBenchmarkScope Scope(Report, TEXT("RegisterEntities"), EntityActors.Num());
+		EntityIDs = Stage->RegisterEntities(EntityActors);
+	}
+
+	// Acts 2..M+1, each overriding every Entity with a distinct state
+	for (int32 ActIndex = 0; ActIndex < NumActs; ++ActIndex)
+	{
+		FAct NewAct;
+		NewAct.SUID = FSUID::MakeActID(Stage->SUID.StageID, ActIndex + 2);
+		NewAct.DisplayName = FString::Printf(TEXT("Act_%d"), ActIndex + 2);
+		NewAct.EntityStateOverrides.Reserve(EntityIDs.Num());
+		for (int32 EntityID : EntityIDs)
+		{
+			if (EntityID >= 0)
+			{
+				NewAct.EntityStateOverrides.Add(EntityID, ActIndex + 1);
+			}
+		}
+		Stage->AddAct(NewAct);
+	}
+
+	return Stage;
+}
+
+//----------------------------------------------------------------
+// Benchmarks
+//----------------------------------------------------------------
+
+void UStageRuntimeBenchmarkCommandlet::RunActivateActBenchmark(const TArray<AStage*>& Stages, FStageBenchmarkReport& Report)
+{
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (AStage* Stage : Stages)
+		{
+			const TArray<int32> ActIDs = Stage->GetAllActIDs();
+
+			// Single Act activations, each applying K Entity states (ops = Acts, as for ActivateActs)
+			for (int32 ActID : ActIDs)
+			{
+				Stage->DeactivateAllActs();
+				FStageBenchmarkScope Scope(Report, TEXT("ActivateAct"));
+				Stage->ActivateAct(ActID);
+			}
+
+			// All Acts at once (batched Entity state application)
+			Stage->DeactivateAllActs();
+			{
+				FStageBenchmarkScope Scope(Report, TEXT("ActivateActs"), ActIDs.Num());
+				Stage->ActivateActs(ActIDs);
+			}
+		}
+	}
+}
+
+void UStageRuntimeBenchmarkCommandlet::RunEffectiveStateBenchmark(const TArray<AStage*>& Stages, FStageBenchmarkReport& Report)
+{
+	int64 Checksum = 0;
+
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (AStage* Stage : Stages)
+		{
+			const TArray<int32> EntityIDs = Stage->GetAllEntityIDs();
+
+			// First query after a change pays for the lazy table rebuild
+			Stage->MarkEffectiveEntityStatesDirty();
+			{
+				FStageBenchmarkScope Scope(Report, TEXT("GetEffectiveEntityState.Cold"), EntityIDs.Num());
+				for (int32 EntityID : EntityIDs)
+				{
+					Checksum += Stage->GetEffectiveEntityState(EntityID);
+				}
+			}
+			{
+				FStageBenchmarkScope Scope(Report, TEXT("GetEffectiveEntityState.Warm"), EntityIDs.Num());
+				for (int32 EntityID : EntityIDs)
+				{
+					Checksum += Stage->GetEffectiveEntityState(EntityID);
+				}
+			}
+		}
+	}
+
+	// Keep the queries observable so they are not optimized away
+	UE_LOG(LogStageRuntimeBenchmark, Verbose, TEXT("Effective state checksum: %lld"), Checksum);
+}
+
+void UStageRuntimeBenchmarkCommandlet::RunStageCycleBenchmark(const TArray<AStage*>& Stages, FStageBenchmarkReport& Report)
+{
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (AStage* Stage : Stages)
+		{
+			Stage->DeactivateAllActs();
+
+			FStageBenchmarkScope Scope(Report, TEXT("StageCycle.UnloadedActiveUnloaded"));
+			Stage->ForceStageStateOverride(EStageRuntimeState::Loaded);
+			Stage->ForceStageStateOverride(EStageRuntimeState::Active);
+			Stage->ForceStageStateOverride(EStageRuntimeState::Unloading);
+
+			// Without a Stage DataLayer, Unloading completes synchronously
+			if (Stage->GetCurrentStageState() != EStageRuntimeState::Unloaded)
+			{
+				Stage->ForceStageStateOverride(EStageRuntimeState::Unloaded);
+			}
+		}
+	}
+}
+
+void UStageRuntimeBenchmarkCommandlet::RunOverlapStormBenchmark(UWorld* World, const TArray<AStage*>& Stages, FStageBenchmarkReport& Report)
+{
+	TArray<AActor*> Pawns;
+	for (int32 PawnIndex = 0; PawnIndex < NumPawns; ++PawnIndex)
+	{
+		if (AActor* Pawn = World->SpawnActor<AActor>())
+		{
+			Pawns.Add(Pawn);
+		}
+	}
+
+	int32 NumStuckStages = 0;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (AStage* Stage : Stages)
+		{
+			UStageTriggerZoneComponent* LoadZone = Stage->BuiltInLoadZone;
+			UStageTriggerZoneComponent* ActivateZone = Stage->BuiltInActivateZone;
+			if (!LoadZone || !ActivateZone)
+			{
+				continue;
+			}
+
+			// Every pawn walks in through both zones and back out again
+			FStageBenchmarkScope Scope(Report, TEXT("OverlapStorm"), Pawns.Num() * 4);
+			for (AActor* Pawn : Pawns)
+			{
+				Stage->HandleZoneBeginOverlap(LoadZone, Pawn);
+				Stage->HandleZoneBeginOverlap(ActivateZone, Pawn);
+			}
+			for (AActor* Pawn : Pawns)
+			{
+				Stage->HandleZoneEndOverlap(ActivateZone, Pawn);
+				Stage->HandleZoneEndOverlap(LoadZone, Pawn);
+			}
+		}
+
+		// Each pass must stream the Stage in and out; otherwise later passes only measure overlap bookkeeping
+		for (AStage* Stage : Stages)
+		{
+			if (Stage->GetCurrentStageState() != EStageRuntimeState::Unloaded)
+			{
+				++NumStuckStages;
+			}
+		}
+	}
+
+	if (NumStuckStages > 0)
+	{
+		UE_LOG(LogStageRuntimeBenchmark, Warning, TEXT("OverlapStorm: %d Stage passes did not return to Unloaded; results understate streaming cost"),
+			NumStuckStages);
+	}
+}
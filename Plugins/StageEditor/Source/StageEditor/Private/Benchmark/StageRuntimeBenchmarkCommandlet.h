@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "StageRuntimeBenchmarkCommandlet.generated.h"
+
+class AActor;
+class AStage;
+class UWorld;
+class FStageBenchmarkReport;
+
+/**
+ * Stage 运行时 Benchmark Commandlet
+ *
+ * 在无渲染的临时 Game World 中程序化生成 N 个 Stage × M 个 Act × K 个 Entity，
+ * 计时 RegisterEntity/RegisterEntities、ActivateAct/ActivateActs、GetEffectiveEntityState、
+ * Unloaded→Active→Unloaded 完整循环以及 TriggerZone Overlap 风暴，输出 JSON/CSV。
+ *
+ * 用法:
+ *   UnrealEditor-Cmd <Project> -run=StageRuntimeBenchmark -nullrhi -unattended
+ *     [-Stages=10] [-Acts=8] [-Entities=500] [-Iterations=20] [-Pawns=32] [-Output=<路径，不含扩展名>]
+ *
+ * 说明:
+ * - 生成的 Stage/Act 不关联 DataLayer，因此完整循环只测量状态机与 Entity 状态应用，不含流送
+ * - 临时 World 不 Tick：运行期间关闭流送调度器（同步派发加载），并将各 Stage 的 UnloadDelay/UnloadExtentPadding 设为 0，
+ *   使 Overlap 风暴每轮都完整经历 Preloading→Active→Unloaded
+ * - ActivateAct 与 ActivateActs 的 ops 单位均为 Act 数，us/op 可直接比较
+ * - 偶数 Stage 用逐个 RegisterEntity 注册、奇数 Stage 用 RegisterEntities 批量注册，各为一组采样
+ */
+UCLASS()
+class UStageRuntimeBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UStageRuntimeBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** 创建临时 Game World（不通知编辑器） */
+	UWorld* CreateBenchmarkWorld();
+
+	/** 销毁临时 World */
+	void DestroyBenchmarkWorld(UWorld* World);
+
+	/** 生成一个 Stage 及其 Act/Entity，并记录注册耗时 */
+	AStage* BuildStage(UWorld* World, int32 StageIndex, FStageBenchmarkReport& Report);
+
+	/** 生成一个带 UStageEntityComponent 的 Actor */
+	AActor* SpawnEntityActor(UWorld* World);
+
+	void RunActivateActBenchmark(const TArray<AStage*>& Stages, FStageBenchmarkReport& Report);
+	void RunEffectiveStateBenchmark(const TArray<AStage*>& Stages, FStageBenchmarkReport& Report);
+	void RunStageCycleBenchmark(const TArray<AStage*>& Stages, FStageBenchmarkReport& Report);
+	void RunOverlapStormBenchmark(UWorld* World, const TArray<AStage*>& Stages, FStageBenchmarkReport& Report);
+
+	int32 NumStages = 10;
+	int32 NumActs = 8;
+	int32 NumEntities = 500;
+	int32 NumIterations = 20;
+	int32 NumPawns = 32;
+};
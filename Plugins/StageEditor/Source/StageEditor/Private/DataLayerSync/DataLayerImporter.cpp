@@ -2,6 +2,7 @@
 
 #include "DataLayerSync/DataLayerImporter.h"
 #include "DataLayerSync/DataLayerSyncUtils.h"
+#include "DataLayerSync/DataLayerMembershipIndex.h"
 #include "DataLayerSync/StageDataLayerNameParser.h"
 #include "DataLayerSync/DataLayerSyncStatusCache.h"
 #include "EditorLogic/StageEditorController.h"
@@ -13,7 +14,6 @@
 #include "WorldPartition/DataLayer/DataLayerInstance.h"
 #include "WorldPartition/DataLayer/DataLayerManager.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
 #include "Editor.h"
 #include "ScopedTransaction.h"
 
@@ -120,17 +120,11 @@ TArray<AActor*> FDataLayerImporter::GetActorsInDataLayer(UDataLayerAsset* Asset,
 		return Result;
 	}
 
-	for (TActorIterator<AActor> It(World); It; ++It)
+	const TSet<const UDataLayerInstance*> InstanceFilter = { Instance };
+	FDataLayerActorBuckets Buckets = FDataLayerMembershipIndex::BucketActorsByDataLayer(World, &InstanceFilter);
+	if (TArray<AActor*>* Bucket = Buckets.Find(Instance))
 	{
-		AActor* Actor = *It;
-		if (Actor && Actor->HasDataLayers())
-		{
-			TArray<const UDataLayerInstance*> ActorDataLayers = Actor->GetDataLayerInstances();
-			if (ActorDataLayers.Contains(Instance))
-			{
-				Result.Add(Actor);
-			}
-		}
+		Result = MoveTemp(*Bucket);
 	}
 
 	return Result;
@@ -171,6 +165,10 @@ FDataLayerImportPreview FDataLayerImporter::GeneratePreview(UDataLayerAsset* Sta
 	// Get child DataLayers (Acts) - collect ALL children regardless of naming
 	TArray<UDataLayerInstance*> ChildInstances = GetChildDataLayers(StageDataLayerAsset, World);
 
+	// Bucket actors for all children in a single world pass
+	const TSet<const UDataLayerInstance*> ChildInstanceSet(ChildInstances);
+	const FDataLayerActorBuckets ActorBuckets = FDataLayerMembershipIndex::BucketActorsByDataLayer(World, &ChildInstanceSet);
+
 	for (UDataLayerInstance* ChildInstance : ChildInstances)
 	{
 		if (!ChildInstance)
@@ -241,17 +239,17 @@ FDataLayerImportPreview FDataLayerImporter::GeneratePreview(UDataLayerAsset* Sta
 		Preview.ActCount++;
 
 		// Get Actors in this Act
-		TArray<AActor*> ActorsInAct = GetActorsInDataLayer(const_cast<UDataLayerAsset*>(ChildAsset), World);
-		if (ActorsInAct.Num() > 0)
+		const TArray<AActor*>* ActorsInAct = ActorBuckets.Find(ChildInstance);
+		if (ActorsInAct && ActorsInAct->Num() > 0)
 		{
 			// Add Entities summary item (Depth 2)
 			FDataLayerImportPreviewItem EntitiesItem;
-			EntitiesItem.DisplayName = FString::Printf(TEXT("Entities: %d actors"), ActorsInAct.Num());
+			EntitiesItem.DisplayName = FString::Printf(TEXT("Entities: %d actors"), ActorsInAct->Num());
 			EntitiesItem.ItemType = TEXT("Entities");
 			EntitiesItem.Depth = 2;
-			EntitiesItem.ActorCount = ActorsInAct.Num();
+			EntitiesItem.ActorCount = ActorsInAct->Num();
 			Preview.Items.Add(EntitiesItem);
-			Preview.EntityCount += ActorsInAct.Num();
+			Preview.EntityCount += ActorsInAct->Num();
 		}
 	}
 
@@ -0,0 +1,333 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DataLayerSync/DataLayerMembershipIndex.h"
+#include "DataLayerSync/DataLayerSyncUtils.h"
+#include "WorldPartition/DataLayer/DataLayerInstance.h"
+#include "WorldPartition/DataLayer/DataLayerManager.h"
+#include "Actors/Stage.h"
+#include "DataLayer/DataLayerEditorSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Editor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDataLayerMembershipIndex, Log, All);
+
+using namespace StageDataLayerSyncUtils;
+
+//----------------------------------------------------------------
+// Singleton
+//----------------------------------------------------------------
+
+FDataLayerMembershipIndex& FDataLayerMembershipIndex::Get()
+{
+	static FDataLayerMembershipIndex Instance;
+	return Instance;
+}
+
+//----------------------------------------------------------------
+// 生命周期
+//----------------------------------------------------------------
+
+void FDataLayerMembershipIndex::Initialize()
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	if (GEngine)
+	{
+		ActorAddedHandle = GEngine->OnLevelActorAdded().AddRaw(
+			this, &FDataLayerMembershipIndex::OnActorAdded);
+		ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddRaw(
+			this, &FDataLayerMembershipIndex::OnActorDeleted);
+		ActorListChangedHandle = GEngine->OnLevelActorListChanged().AddRaw(
+			this, &FDataLayerMembershipIndex::OnActorListChanged);
+	}
+
+	if (GEditor)
+	{
+		if (UDataLayerEditorSubsystem* DLSubsystem = GEditor->GetEditorSubsystem<UDataLayerEditorSubsystem>())
+		{
+			ActorDataLayersChangedHandle = DLSubsystem->OnActorDataLayersChanged().AddRaw(
+				this, &FDataLayerMembershipIndex::OnActorDataLayersChanged);
+			DataLayerChangedHandle = DLSubsystem->OnDataLayerChanged().AddRaw(
+				this, &FDataLayerMembershipIndex::OnDataLayerChanged);
+		}
+	}
+
+	bIsDirty = true;
+	bIsInitialized = true;
+}
+
+void FDataLayerMembershipIndex::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	if (GEngine)
+	{
+		GEngine->OnLevelActorAdded().Remove(ActorAddedHandle);
+		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
+		GEngine->OnLevelActorListChanged().Remove(ActorListChangedHandle);
+	}
+
+	if (GEditor)
+	{
+		if (UDataLayerEditorSubsystem* DLSubsystem = GEditor->GetEditorSubsystem<UDataLayerEditorSubsystem>())
+		{
+			DLSubsystem->OnActorDataLayersChanged().Remove(ActorDataLayersChangedHandle);
+			DLSubsystem->OnDataLayerChanged().Remove(DataLayerChangedHandle);
+		}
+	}
+
+	ActorAddedHandle.Reset();
+	ActorDeletedHandle.Reset();
+	ActorListChangedHandle.Reset();
+	ActorDataLayersChangedHandle.Reset();
+	DataLayerChangedHandle.Reset();
+
+	InstanceToActors.Empty();
+	ActorToInstances.Empty();
+	IndexedWorld.Reset();
+	bIsDirty = true;
+	bIsInitialized = false;
+}
+
+//----------------------------------------------------------------
+// 查询
+//----------------------------------------------------------------
+
+const TSet<FSoftObjectPath>* FDataLayerMembershipIndex::FindActors(const UDataLayerInstance* Instance)
+{
+	if (!Instance)
+	{
+		return nullptr;
+	}
+
+	EnsureUpToDate();
+
+	return InstanceToActors.Find(Instance);
+}
+
+TSet<FSoftObjectPath> FDataLayerMembershipIndex::CollectStageActMemberPaths(const AStage* Stage)
+{
+	TSet<FSoftObjectPath> MemberPaths;
+
+	UDataLayerManager* Manager = Stage ? UDataLayerManager::GetDataLayerManager(Stage) : nullptr;
+	if (!Manager)
+	{
+		return MemberPaths;
+	}
+
+	for (const FAct& Act : Stage->Acts)
+	{
+		if (!Act.AssociatedDataLayer)
+		{
+			continue;
+		}
+
+		if (const TSet<FSoftObjectPath>* Members = FindActors(Manager->GetDataLayerInstance(Act.AssociatedDataLayer)))
+		{
+			MemberPaths.Append(*Members);
+		}
+	}
+
+	return MemberPaths;
+}
+
+FDataLayerActorBuckets FDataLayerMembershipIndex::BucketActorsByDataLayer(
+	UWorld* World,
+	const TSet<const UDataLayerInstance*>* InstanceFilter,
+	const AActor* ExcludedActor)
+{
+	FDataLayerActorBuckets Buckets;
+
+	if (!World || (InstanceFilter && InstanceFilter->Num() == 0))
+	{
+		return Buckets;
+	}
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AActor* Actor = *It;
+		if (!Actor || Actor == ExcludedActor || !Actor->HasDataLayers())
+		{
+			continue;
+		}
+
+		for (const UDataLayerInstance* Instance : Actor->GetDataLayerInstances())
+		{
+			if (Instance && (!InstanceFilter || InstanceFilter->Contains(Instance)))
+			{
+				Buckets.FindOrAdd(Instance).Add(Actor);
+			}
+		}
+	}
+
+	return Buckets;
+}
+
+//----------------------------------------------------------------
+// 内部方法
+//----------------------------------------------------------------
+
+void FDataLayerMembershipIndex::EnsureUpToDate()
+{
+	UWorld* World = GetEditorWorld();
+	if (!World)
+	{
+		InstanceToActors.Reset();
+		ActorToInstances.Reset();
+		IndexedWorld.Reset();
+		bIsDirty = true;
+		return;
+	}
+
+	// Editor world switched (map change) or a bulk change we can't track per actor
+	if (bIsDirty || IndexedWorld.Get() != World)
+	{
+		Rebuild(World);
+	}
+}
+
+void FDataLayerMembershipIndex::Rebuild(UWorld* World)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	InstanceToActors.Reset();
+	ActorToInstances.Reset();
+	IndexedWorld = World;
+	bIsDirty = false;
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		AddActor(*It, false);
+	}
+
+	UE_LOG(LogDataLayerMembershipIndex, Log, TEXT("Rebuilt DataLayer membership index: %d actors in %d DataLayers (%.2f ms)"),
+		ActorToInstances.Num(), InstanceToActors.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FDataLayerMembershipIndex::AddActor(AActor* Actor, bool bBroadcast)
+{
+	if (!Actor || !Actor->HasDataLayers())
+	{
+		return;
+	}
+
+	const FSoftObjectPath ActorPath(Actor);
+	TArray<TObjectKey<UDataLayerInstance>>& Memberships = ActorToInstances.FindOrAdd(ActorPath);
+
+	for (const UDataLayerInstance* Instance : Actor->GetDataLayerInstances())
+	{
+		if (!Instance)
+		{
+			continue;
+		}
+
+		InstanceToActors.FindOrAdd(Instance).Add(ActorPath);
+		Memberships.AddUnique(Instance);
+
+		if (bBroadcast)
+		{
+			MembershipChangedEvent.Broadcast(Instance);
+		}
+	}
+
+	if (Memberships.Num() == 0)
+	{
+		ActorToInstances.Remove(ActorPath);
+	}
+}
+
+void FDataLayerMembershipIndex::RemoveActor(const FSoftObjectPath& ActorPath, bool bBroadcast)
+{
+	TArray<TObjectKey<UDataLayerInstance>> Memberships;
+	if (!ActorToInstances.RemoveAndCopyValue(ActorPath, Memberships))
+	{
+		return;
+	}
+
+	for (const TObjectKey<UDataLayerInstance>& InstanceKey : Memberships)
+	{
+		if (TSet<FSoftObjectPath>* Actors = InstanceToActors.Find(InstanceKey))
+		{
+			Actors->Remove(ActorPath);
+			if (Actors->Num() == 0)
+			{
+				InstanceToActors.Remove(InstanceKey);
+			}
+		}
+
+		if (bBroadcast)
+		{
+			if (const UDataLayerInstance* Instance = InstanceKey.ResolveObjectPtr())
+			{
+				MembershipChangedEvent.Broadcast(Instance);
+			}
+		}
+	}
+}
+
+bool FDataLayerMembershipIndex::IsIndexedActor(const AActor* Actor) const
+{
+	// Not built yet: the next query scans the world anyway
+	return Actor && !bIsDirty && IndexedWorld.IsValid() && Actor->GetWorld() == IndexedWorld.Get();
+}
+
+//----------------------------------------------------------------
+// 事件回调
+//----------------------------------------------------------------
+
+void FDataLayerMembershipIndex::OnActorAdded(AActor* Actor)
+{
+	if (!IsIndexedActor(Actor))
+	{
+		return;
+	}
+
+	RemoveActor(FSoftObjectPath(Actor), false);
+	AddActor(Actor, true);
+}
+
+void FDataLayerMembershipIndex::OnActorDeleted(AActor* Actor)
+{
+	if (!IsIndexedActor(Actor))
+	{
+		return;
+	}
+
+	RemoveActor(FSoftObjectPath(Actor), true);
+}
+
+void FDataLayerMembershipIndex::OnActorListChanged()
+{
+	// Bulk level change (level load/unload, WP region load): rebuild on next query
+	bIsDirty = true;
+}
+
+void FDataLayerMembershipIndex::OnActorDataLayersChanged(const TWeakObjectPtr<AActor>& ChangedActor)
+{
+	AActor* Actor = ChangedActor.Get();
+	if (!IsIndexedActor(Actor))
+	{
+		return;
+	}
+
+	// Old memberships are only known to the index, so diff by remove + add
+	RemoveActor(FSoftObjectPath(Actor), true);
+	AddActor(Actor, true);
+}
+
+void FDataLayerMembershipIndex::OnDataLayerChanged(const EDataLayerAction Action, const TWeakObjectPtr<const UDataLayerInstance>& ChangedInstance, const FName& ChangedProperty)
+{
+	// Deleting a DataLayer strips it from its actors without per-actor events
+	if (Action == EDataLayerAction::Delete || Action == EDataLayerAction::Reset)
+	{
+		bIsDirty = true;
+	}
+}
@@ -2,6 +2,7 @@
 
 #include "DataLayerSync/DataLayerSyncStatus.h"
 #include "DataLayerSync/DataLayerSyncUtils.h"
+#include "DataLayerSync/DataLayerMembershipIndex.h"
 #include "Subsystems/StageManagerSubsystem.h"
 #include "Actors/Stage.h"
 #include "Core/StageCoreTypes.h"
@@ -9,7 +10,6 @@
 #include "WorldPartition/DataLayer/DataLayerInstance.h"
 #include "WorldPartition/DataLayer/DataLayerManager.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
 #include "Editor.h"
 
 #define LOCTEXT_NAMESPACE "StageEditorDataLayerSync"
@@ -156,20 +156,10 @@ namespace
 			return;
 		}
 
-		// Get current actors in this DataLayer
-		TSet<FSoftObjectPath> CurrentActorPaths;
-		for (TActorIterator<AActor> It(World); It; ++It)
-		{
-			AActor* Actor = *It;
-			if (Actor && Actor->HasDataLayers())
-			{
-				TArray<const UDataLayerInstance*> ActorDataLayers = Actor->GetDataLayerInstances();
-				if (ActorDataLayers.Contains(Instance))
-				{
-					CurrentActorPaths.Add(FSoftObjectPath(Actor));
-				}
-			}
-		}
+		// Get current actors in this DataLayer from the membership index (no world scan)
+		static const TSet<FSoftObjectPath> EmptyActorPaths;
+		const TSet<FSoftObjectPath>* IndexedActorPaths = FDataLayerMembershipIndex::Get().FindActors(Instance);
+		const TSet<FSoftObjectPath>& CurrentActorPaths = IndexedActorPaths ? *IndexedActorPaths : EmptyActorPaths;
 
 		// Get registered Entitys from Stage's EntityRegistry
 		TSet<FSoftObjectPath> RegisteredEntityPaths;
@@ -190,9 +180,11 @@ namespace
 			}
 		}
 
+		// Same removal rule as the synchronizer: only Entities that left every Act DataLayer of the Stage
+		const TSet<FSoftObjectPath> StageActMemberPaths = FDataLayerMembershipIndex::Get().CollectStageActMemberPaths(Stage);
 		for (const FSoftObjectPath& Path : RegisteredEntityPaths)
 		{
-			if (!CurrentActorPaths.Contains(Path))
+			if (FDataLayerMembershipIndex::ShouldUnregisterEntity(Path, StageActMemberPaths))
 			{
 				OutInfo.RemovedActorCount++;
 			}
@@ -418,17 +410,13 @@ TArray<TSoftObjectPtr<AActor>> FDataLayerSyncStatusDetector::GetCurrentActors(co
 		return Result;
 	}
 
-	// Iterate all Actors in the world, check if they belong to this DataLayer
-	for (TActorIterator<AActor> It(World); It; ++It)
+	// Look up members in the membership index instead of iterating the world
+	if (const TSet<FSoftObjectPath>* ActorPaths = FDataLayerMembershipIndex::Get().FindActors(Instance))
 	{
-		AActor* Actor = *It;
-		if (Actor && Actor->HasDataLayers())
+		Result.Reserve(ActorPaths->Num());
+		for (const FSoftObjectPath& Path : *ActorPaths)
 		{
-			TArray<const UDataLayerInstance*> ActorDataLayers = Actor->GetDataLayerInstances();
-			if (ActorDataLayers.Contains(Instance))
-			{
-				Result.Add(TSoftObjectPtr<AActor>(Actor));
-			}
+			Result.Add(TSoftObjectPtr<AActor>(Path));
 		}
 	}
 
@@ -2,6 +2,8 @@
 
 #include "DataLayerSync/DataLayerSyncStatusCache.h"
 #include "DataLayerSync/DataLayerSyncStatus.h"
+#include "DataLayerSync/DataLayerMembershipIndex.h"
+#include "DataLayerSync/DataLayerSyncUtils.h"
 #include "WorldPartition/DataLayer/DataLayerAsset.h"
 #include "WorldPartition/DataLayer/DataLayerInstance.h"
 #include "DataLayer/DataLayerEditorSubsystem.h"
@@ -37,7 +39,7 @@ void FDataLayerSyncStatusCache::Initialize()
 
 	UE_LOG(LogDataLayerSyncCache, Log, TEXT("Initializing DataLayerSyncStatusCache (event-driven mode)"));
 
-	// 绑定事件 - 纯事件驱动，不再使用后台 Ticker
+	// 绑定事件 - 事件驱动失效，Ticker 仅在有待计算条目时存在
 	BindEvents();
 
 	bIsInitialized = true;
@@ -55,6 +57,15 @@ void FDataLayerSyncStatusCache::Shutdown()
 	// 解绑事件
 	UnbindEvents();
 
+	// 停止后台计算
+	if (RecomputeTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RecomputeTickerHandle);
+		RecomputeTickerHandle.Reset();
+	}
+	PendingRecompute.Empty();
+	PendingRecomputeSet.Empty();
+
 	// 清空缓存
 	Cache.Empty();
 
@@ -77,27 +88,25 @@ FDataLayerSyncStatusInfo FDataLayerSyncStatusCache::GetCachedStatus(const UDataL
 	TWeakObjectPtr<const UDataLayerAsset> WeakAsset(Asset);
 
 	// 查找缓存
-	if (FCachedSyncStatus* CachedStatus = Cache.Find(WeakAsset))
+	FCachedSyncStatus* CachedStatus = Cache.Find(WeakAsset);
+	if (CachedStatus && CachedStatus->bIsValid)
 	{
 		// 缓存有效则直接返回
-		if (CachedStatus->bIsValid)
-		{
-			return CachedStatus->Info;
-		}
-
-		// 缓存已失效，立即计算新值并更新缓存
-		FDataLayerSyncStatusInfo NewInfo = ComputeStatus(Asset);
-		CachedStatus->Info = NewInfo;
-		CachedStatus->bIsValid = true;
+		return CachedStatus->Info;
+	}
 
-		return NewInfo;
+	// 无缓存时以 NotImported 占位（bIsValid = false）
+	if (!CachedStatus)
+	{
+		CachedStatus = &Cache.Add(WeakAsset, FCachedSyncStatus());
 	}
 
-	// 无缓存，立即计算并缓存
-	FDataLayerSyncStatusInfo NewInfo = ComputeStatus(Asset);
-	Cache.Add(WeakAsset, FCachedSyncStatus(NewInfo));
+	// 缓存已失效：返回上一次的值，后台重新计算
+	ScheduleRecompute(Asset);
 
-	return NewInfo;
+	FDataLayerSyncStatusInfo StaleInfo = CachedStatus->Info;
+	StaleInfo.bIsStale = true;
+	return StaleInfo;
 }
 
 bool FDataLayerSyncStatusCache::HasValidCache(const UDataLayerAsset* Asset) const
@@ -133,6 +142,20 @@ void FDataLayerSyncStatusCache::InvalidateCache(const UDataLayerAsset* Asset)
 	}
 }
 
+void FDataLayerSyncStatusCache::InvalidateStage(const AStage* Stage)
+{
+	if (!Stage)
+	{
+		return;
+	}
+
+	InvalidateCache(Stage->StageDataLayerAsset);
+	for (const FAct& Act : Stage->Acts)
+	{
+		InvalidateCache(Act.AssociatedDataLayer);
+	}
+}
+
 void FDataLayerSyncStatusCache::InvalidateAll()
 {
 	UE_LOG(LogDataLayerSyncCache, Log, TEXT("Invalidating all cache entries (%d)"), Cache.Num());
@@ -155,9 +178,13 @@ FDataLayerSyncStatusInfo FDataLayerSyncStatusCache::ForceRefresh(const UDataLaye
 	// 立即计算
 	FDataLayerSyncStatusInfo Info = ComputeStatus(Asset);
 
-	// 更新缓存
+	// 更新缓存（已是最新值，无需后台计算）
 	TWeakObjectPtr<const UDataLayerAsset> WeakAsset(Asset);
 	Cache.Add(WeakAsset, FCachedSyncStatus(Info));
+	if (PendingRecomputeSet.Remove(WeakAsset) > 0)
+	{
+		PendingRecompute.Remove(WeakAsset);
+	}
 
 	UE_LOG(LogDataLayerSyncCache, Verbose, TEXT("Force refreshed: %s -> Status=%d"),
 		*Asset->GetName(), (int32)Info.Status);
@@ -175,6 +202,79 @@ FDataLayerSyncStatusInfo FDataLayerSyncStatusCache::ComputeStatus(const UDataLay
 	return FDataLayerSyncStatusDetector::DetectStatus(Asset);
 }
 
+void FDataLayerSyncStatusCache::ScheduleRecompute(const UDataLayerAsset* Asset)
+{
+	TWeakObjectPtr<const UDataLayerAsset> WeakAsset(Asset);
+
+	bool bAlreadyPending = false;
+	PendingRecomputeSet.Add(WeakAsset, &bAlreadyPending);
+	if (bAlreadyPending)
+	{
+		return;
+	}
+
+	PendingRecompute.Add(WeakAsset);
+
+	if (!RecomputeTickerHandle.IsValid())
+	{
+		RecomputeTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FDataLayerSyncStatusCache::TickRecompute));
+	}
+}
+
+bool FDataLayerSyncStatusCache::TickRecompute(float DeltaTime)
+{
+	// DetectStatus 访问 UObject/World，只能在游戏线程执行，因此按时间预算分帧
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<TWeakObjectPtr<const UDataLayerAsset>> UpdatedAssets;
+	int32 ProcessedCount = 0;
+
+	while (ProcessedCount < PendingRecompute.Num())
+	{
+		TWeakObjectPtr<const UDataLayerAsset> WeakAsset = PendingRecompute[ProcessedCount++];
+		PendingRecomputeSet.Remove(WeakAsset);
+
+		const UDataLayerAsset* Asset = WeakAsset.Get();
+		if (!Asset)
+		{
+			Cache.Remove(WeakAsset);
+			continue;
+		}
+
+		FCachedSyncStatus* CachedStatus = Cache.Find(WeakAsset);
+		if (CachedStatus && !CachedStatus->bIsValid)
+		{
+			*CachedStatus = FCachedSyncStatus(ComputeStatus(Asset));
+			UpdatedAssets.Add(WeakAsset);
+		}
+
+		if (FPlatformTime::Seconds() - StartTime >= RecomputeBudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	PendingRecompute.RemoveAt(0, ProcessedCount, EAllowShrinking::No);
+
+	if (UpdatedAssets.Num() > 0)
+	{
+		UE_LOG(LogDataLayerSyncCache, Verbose, TEXT("Recomputed %d entries (%d pending, %.2f ms)"),
+			UpdatedAssets.Num(), PendingRecompute.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+		StatusUpdatedEvent.Broadcast(UpdatedAssets);
+	}
+
+	// Unregister once the queue drains; ScheduleRecompute re-adds the ticker
+	if (PendingRecompute.Num() == 0)
+	{
+		RecomputeTickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
 //----------------------------------------------------------------
 // 事件绑定
 //----------------------------------------------------------------
@@ -201,7 +301,11 @@ void FDataLayerSyncStatusCache::BindEvents()
 			this, &FDataLayerSyncStatusCache::OnActorRemovedFromWorld);
 	}
 
-	// 3. Stage 注册/注销事件 - 监听 PostLoad 等方式注册的 Stage
+	// 3. Actor DataLayer 成员变化（包括 Actor 的 DataLayer 被修改）
+	MembershipChangedHandle = FDataLayerMembershipIndex::Get().OnMembershipChanged().AddRaw(
+		this, &FDataLayerSyncStatusCache::OnDataLayerMembershipChanged);
+
+	// 4. Stage 注册/注销事件 - 监听 PostLoad 等方式注册的 Stage
 	if (GEditor)
 	{
 		UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -238,7 +342,10 @@ void FDataLayerSyncStatusCache::UnbindEvents()
 		GEngine->OnLevelActorDeleted().Remove(ActorDeletedHandle);
 	}
 
-	// 3. Stage 注册/注销事件
+	// 3. Actor DataLayer 成员变化
+	FDataLayerMembershipIndex::Get().OnMembershipChanged().Remove(MembershipChangedHandle);
+
+	// 4. Stage 注册/注销事件
 	if (GEditor)
 	{
 		UWorld* World = GEditor->GetEditorWorldContext().World();
@@ -261,6 +368,7 @@ void FDataLayerSyncStatusCache::UnbindEvents()
 	DataLayerChangedHandle.Reset();
 	ActorAddedHandle.Reset();
 	ActorDeletedHandle.Reset();
+	MembershipChangedHandle.Reset();
 	StageRegisteredHandle.Reset();
 	StageUnregisteredHandle.Reset();
 
@@ -336,31 +444,50 @@ void FDataLayerSyncStatusCache::OnActorRemovedFromWorld(AActor* Actor)
 		Actor ? *Actor->GetName() : TEXT("null"));
 }
 
-void FDataLayerSyncStatusCache::OnStageRegistered(AStage* Stage)
+void FDataLayerSyncStatusCache::OnDataLayerMembershipChanged(const UDataLayerInstance* Instance)
 {
-	if (!Stage)
+	if (!Instance)
 	{
 		return;
 	}
 
-	// 失效 Stage 关联的 DataLayer 缓存
-	if (Stage->StageDataLayerAsset)
+	if (const UDataLayerAsset* Asset = Instance->GetAsset())
 	{
-		InvalidateCache(Stage->StageDataLayerAsset);
-		UE_LOG(LogDataLayerSyncCache, Log, TEXT("OnStageRegistered: Invalidated cache for Stage '%s' DataLayer '%s'"),
-			*Stage->GetActorLabel(), *Stage->StageDataLayerAsset->GetName());
+		InvalidateCache(Asset);
+
+		// 同一 Stage 的其他 Act 共用 Entity 注销规则，一并失效
+		if (UStageManagerSubsystem* Subsystem = StageDataLayerSyncUtils::GetStageManagerSubsystem())
+		{
+			InvalidateStage(Subsystem->FindStageByDataLayer(const_cast<UDataLayerAsset*>(Asset)));
+		}
 	}
 
-	// 也失效所有 Act 的 DataLayer 缓存
-	for (const FAct& Act : Stage->Acts)
+	// 也失效父 DataLayer（Stage 级别）
+	if (const UDataLayerInstance* Parent = Instance->GetParent())
 	{
-		if (Act.AssociatedDataLayer)
+		if (const UDataLayerAsset* ParentAsset = Parent->GetAsset())
 		{
-			InvalidateCache(Act.AssociatedDataLayer);
+			InvalidateCache(ParentAsset);
 		}
 	}
 }
 
+void FDataLayerSyncStatusCache::OnStageRegistered(AStage* Stage)
+{
+	if (!Stage)
+	{
+		return;
+	}
+
+	// 失效 Stage 及其所有 Act 的 DataLayer 缓存
+	InvalidateStage(Stage);
+	if (Stage->StageDataLayerAsset)
+	{
+		UE_LOG(LogDataLayerSyncCache, Log, TEXT("OnStageRegistered: Invalidated cache for Stage '%s' DataLayer '%s'"),
+			*Stage->GetActorLabel(), *Stage->StageDataLayerAsset->GetName());
+	}
+}
+
 void FDataLayerSyncStatusCache::OnStageUnregistered(AStage* Stage, int32 StageID)
 {
 	// Stage 可能已经被销毁，所以可能是 nullptr
@@ -4,6 +4,7 @@
 #include "DataLayerSync/DataLayerSyncUtils.h"
 #include "DataLayerSync/DataLayerSyncStatus.h"
 #include "DataLayerSync/DataLayerSyncStatusCache.h"
+#include "DataLayerSync/DataLayerMembershipIndex.h"
 #include "DataLayerSync/StageDataLayerNameParser.h"
 #include "Subsystems/StageManagerSubsystem.h"
 #include "Actors/Stage.h"
@@ -12,9 +13,10 @@
 #include "WorldPartition/DataLayer/DataLayerInstance.h"
 #include "WorldPartition/DataLayer/DataLayerManager.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
 #include "Editor.h"
 #include "ScopedTransaction.h"
+#include "Async/ParallelFor.h"
+#include "DebugHeader.h"
 
 #define LOCTEXT_NAMESPACE "StageEditorDataLayerSync"
 
@@ -159,8 +161,9 @@ FDataLayerSyncResult FDataLayerSynchronizer::SyncDataLayer(UDataLayerAsset* Data
 		Result = SyncActLevelChanges(Stage, ActID, DataLayerAsset, StatusInfo, World);
 	}
 
-	// Invalidate cache
+	// Invalidate cache (sibling Act rows share the removal rule, so the whole Stage)
 	FDataLayerSyncStatusCache::Get().InvalidateCache(DataLayerAsset);
+	FDataLayerSyncStatusCache::Get().InvalidateStage(Stage);
 
 	// Broadcast stage data changed to notify StageEditorPanel to refresh
 	if (Result.bSuccess)
@@ -185,55 +188,284 @@ FDataLayerBatchSyncResult FDataLayerSynchronizer::SyncAllOutOfSync(UWorld* World
 	}
 
 	UDataLayerManager* Manager = UDataLayerManager::GetDataLayerManager(World);
-	if (!Manager)
+	UStageManagerSubsystem* Subsystem = GetStageManagerSubsystem(World);
+	if (!Manager || !Subsystem)
 	{
 		return BatchResult;
 	}
 
-	// Collect all DataLayers that are out of sync
-	TArray<UDataLayerAsset*> OutOfSyncAssets;
-
+	TArray<UDataLayerInstance*> Instances;
 	Manager->ForEachDataLayerInstance([&](UDataLayerInstance* Instance)
 	{
-		if (Instance)
+		if (Instance && Instance->GetAsset())
 		{
-			UDataLayerAsset* Asset = const_cast<UDataLayerAsset*>(Instance->GetAsset());
-			if (Asset)
+			Instances.Add(Instance);
+		}
+		return true; // Continue iteration
+	});
+
+	// Work: snapshot per DataLayer + one parallel diff + apply per DataLayer
+	TUniquePtr<FScopedSlowTask> SlowTask = DebugHeader::CreateProgressTask(
+		Instances.Num() * 2 + 1, LOCTEXT("SyncAllProgress", "Syncing DataLayers..."));
+
+	//----------------------------------------------------------------
+	// Phase 1: Snapshot (game thread, read-only)
+	//----------------------------------------------------------------
+
+	TArray<FDataLayerBatchSyncItem> Items;
+	TMap<AStage*, FDataLayerBatchSyncStageSnapshot> StageSnapshots;
+	TSet<const UDataLayerInstance*> ActInstances;
+
+	for (UDataLayerInstance* Instance : Instances)
+	{
+		SlowTask->EnterProgressFrame(1, FText::Format(LOCTEXT("SyncAllAnalyzing", "Analyzing {0}..."),
+			FText::FromString(Instance->GetAsset()->GetName())));
+		if (SlowTask->ShouldCancel())
+		{
+			BatchResult.bWasCancelled = true;
+			return BatchResult;
+		}
+
+		UDataLayerAsset* Asset = const_cast<UDataLayerAsset*>(Instance->GetAsset());
+		AStage* Stage = Subsystem->FindStageByDataLayer(Asset);
+		if (!Stage)
+		{
+			BatchResult.SkippedCount++; // NotImported
+			continue;
+		}
+
+		FDataLayerBatchSyncItem& Item = Items.AddDefaulted_GetRef();
+		Item.Asset = Asset;
+		Item.Instance = Instance;
+		Item.Stage = Stage;
+		Item.bStageLevel = (Stage->StageDataLayerAsset == Asset);
+
+		if (Item.bStageLevel)
+		{
+			// Child DataLayer comparison is cheap and needs the DataLayerManager, so it stays here
+			Item.StatusInfo = FDataLayerSyncStatusDetector::DetectStatus(Asset);
+			Item.bOutOfSync = (Item.StatusInfo.Status == EDataLayerSyncStatus::OutOfSync);
+		}
+		else
+		{
+			Item.ActID = Subsystem->FindActIDByDataLayer(Stage, Asset);
+			ActInstances.Add(Instance);
+
+			if (!StageSnapshots.Contains(Stage))
 			{
-				FDataLayerSyncStatusInfo StatusInfo = FDataLayerSyncStatusDetector::DetectStatus(Asset);
-				if (StatusInfo.Status == EDataLayerSyncStatus::OutOfSync)
+				FDataLayerBatchSyncStageSnapshot& Snapshot = StageSnapshots.Add(Stage);
+				for (const auto& Pair : Stage->EntityRegistry)
 				{
-					OutOfSyncAssets.AddUnique(Asset);
+					if (Pair.Value.IsValid())
+					{
+						const FSoftObjectPath EntityPath = Pair.Value.ToSoftObjectPath();
+						Snapshot.RegisteredEntities.Emplace(Pair.Key, EntityPath);
+						Snapshot.RegisteredEntityPaths.Add(EntityPath);
+					}
 				}
-				else if (StatusInfo.Status == EDataLayerSyncStatus::Synced ||
-						 StatusInfo.Status == EDataLayerSyncStatus::NotImported)
+				Snapshot.ActMemberPaths = FDataLayerMembershipIndex::Get().CollectStageActMemberPaths(Stage);
+			}
+		}
+	}
+
+	// One world pass for every Act-level DataLayer
+	const FDataLayerActorBuckets ActorBuckets = FDataLayerMembershipIndex::BucketActorsByDataLayer(World, &ActInstances);
+	for (FDataLayerBatchSyncItem& Item : Items)
+	{
+		if (Item.bStageLevel)
+		{
+			continue;
+		}
+
+		if (const TArray<AActor*>* Bucket = ActorBuckets.Find(Item.Instance))
+		{
+			Item.CurrentActors.Reserve(Bucket->Num());
+			Item.CurrentActorPaths.Reserve(Bucket->Num());
+			for (AActor* Actor : *Bucket)
+			{
+				if (Actor != Item.Stage)
 				{
-					BatchResult.SkippedCount++;
+					Item.CurrentActors.Add(Actor);
+					Item.CurrentActorPaths.Emplace(Actor);
 				}
 			}
 		}
-		return true; // Continue iteration
-	});
+	}
+
+	//----------------------------------------------------------------
+	// Phase 2: Diff (parallel, plain data only)
+	//----------------------------------------------------------------
 
-	// Sync each out-of-sync DataLayer
-	for (UDataLayerAsset* Asset : OutOfSyncAssets)
+	SlowTask->EnterProgressFrame(1, LOCTEXT("SyncAllDiffing", "Computing changes..."));
+
+	ParallelFor(Items.Num(), [&Items, &StageSnapshots](int32 Index)
 	{
-		FDataLayerSyncResult SingleResult = SyncDataLayer(Asset, World);
-		if (SingleResult.bSuccess)
+		FDataLayerBatchSyncItem& Item = Items[Index];
+		if (Item.bStageLevel)
 		{
-			BatchResult.SyncedCount++;
-			BatchResult.TotalActChanges += SingleResult.AddedActCount + SingleResult.RemovedActCount;
-			BatchResult.TotalEntityChanges += SingleResult.AddedEntityCount + SingleResult.RemovedEntityCount;
+			return;
 		}
-		else
+
+		const FDataLayerBatchSyncStageSnapshot& Snapshot = StageSnapshots.FindChecked(Item.Stage);
+
+		for (int32 ActorIndex = 0; ActorIndex < Item.CurrentActorPaths.Num(); ++ActorIndex)
+		{
+			if (!Snapshot.RegisteredEntityPaths.Contains(Item.CurrentActorPaths[ActorIndex]))
+			{
+				Item.ActorsToRegister.Add(Item.CurrentActors[ActorIndex]);
+			}
+		}
+
+		// Shared removal rule: members of the Stage's other Act DataLayers survive this Act's diff
+		for (const TPair<int32, FSoftObjectPath>& Entity : Snapshot.RegisteredEntities)
+		{
+			if (FDataLayerMembershipIndex::ShouldUnregisterEntity(Entity.Value, Snapshot.ActMemberPaths))
+			{
+				Item.EntityIDsToRemove.Add(Entity.Key);
+			}
+		}
+
+		Item.bOutOfSync = Item.ActorsToRegister.Num() > 0 || Item.EntityIDsToRemove.Num() > 0;
+	});
+
+	if (SlowTask->ShouldCancel())
+	{
+		BatchResult.bWasCancelled = true;
+		return BatchResult;
+	}
+
+	//----------------------------------------------------------------
+	// Phase 3: Apply (game thread, single transaction)
+	//----------------------------------------------------------------
+
+	// From here StageSnapshots is live state: items sharing a Stage were diffed against the same snapshot
+	TSet<AStage*> ChangedStages;
+	{
+		FScopedTransaction Transaction(LOCTEXT("SyncAllDataLayers", "Sync All DataLayers"));
+
+		for (const FDataLayerBatchSyncItem& Item : Items)
 		{
-			BatchResult.FailedCount++;
+			SlowTask->EnterProgressFrame(1, FText::Format(LOCTEXT("SyncAllApplying", "Syncing {0}..."),
+				FText::FromString(Item.Asset->GetName())));
+			if (SlowTask->ShouldCancel())
+			{
+				// Already applied items stay in the transaction and can be undone as one step
+				BatchResult.bWasCancelled = true;
+				break;
+			}
+
+			if (!Item.bOutOfSync)
+			{
+				BatchResult.SkippedCount++; // Synced
+				continue;
+			}
+
+			Item.Stage->Modify();
+
+			FDataLayerSyncResult SingleResult;
+			if (Item.bStageLevel)
+			{
+				SingleResult = SyncStageLevelChanges(Item.Stage, Item.StatusInfo, World);
+
+				// New Acts register their members directly and change the Act set, so re-read both
+				if (FDataLayerBatchSyncStageSnapshot* StageState = StageSnapshots.Find(Item.Stage))
+				{
+					StageState->RegisteredEntityPaths.Reset();
+					for (const auto& Pair : Item.Stage->EntityRegistry)
+					{
+						if (Pair.Value.IsValid())
+						{
+							StageState->RegisteredEntityPaths.Add(Pair.Value.ToSoftObjectPath());
+						}
+					}
+					StageState->ActMemberPaths = FDataLayerMembershipIndex::Get().CollectStageActMemberPaths(Item.Stage);
+				}
+			}
+			else
+			{
+				SingleResult = ApplyActLevelDiff(Item, StageSnapshots.FindChecked(Item.Stage));
+			}
+
+			FDataLayerSyncStatusCache::Get().InvalidateCache(Item.Asset);
+
+			if (SingleResult.bSuccess)
+			{
+				ChangedStages.Add(Item.Stage);
+				BatchResult.SyncedCount++;
+				BatchResult.TotalActChanges += SingleResult.AddedActCount + SingleResult.RemovedActCount;
+				BatchResult.TotalEntityChanges += SingleResult.AddedEntityCount + SingleResult.RemovedEntityCount;
+			}
+			else
+			{
+				BatchResult.FailedCount++;
+			}
 		}
 	}
 
+	// Notify once per Stage rather than once per DataLayer; every Act row of the Stage shares the removal rule
+	for (AStage* Stage : ChangedStages)
+	{
+		FDataLayerSyncStatusCache::Get().InvalidateStage(Stage);
+		Subsystem->BroadcastStageDataChanged(Stage);
+	}
+
 	return BatchResult;
 }
 
+FDataLayerSyncResult FDataLayerSynchronizer::ApplyActLevelDiff(const FDataLayerBatchSyncItem& Item, FDataLayerBatchSyncStageSnapshot& StageState)
+{
+	FDataLayerSyncResult Result;
+	Result.bSuccess = true;
+
+	AStage* Stage = Item.Stage;
+	if (!Stage || Item.ActID < 0)
+	{
+		Result.bSuccess = false;
+		Result.ErrorMessage = LOCTEXT("ErrorInvalidActParams", "Invalid Stage, World, or ActID");
+		return Result;
+	}
+
+	// Register new actors as Entitys (an earlier item of the same Stage may already have registered them)
+	TArray<AActor*> ActorsToRegister;
+	ActorsToRegister.Reserve(Item.ActorsToRegister.Num());
+	for (AActor* Actor : Item.ActorsToRegister)
+	{
+		bool bAlreadyRegistered = false;
+		StageState.RegisteredEntityPaths.Add(FSoftObjectPath(Actor), &bAlreadyRegistered);
+		if (!bAlreadyRegistered)
+		{
+			ActorsToRegister.Add(Actor);
+		}
+	}
+
+	for (int32 EntityID : Stage->RegisterEntities(ActorsToRegister))
+	{
+		if (EntityID >= 0)
+		{
+			// Set default state in this Act
+			if (FAct* Act = Stage->FindActByID(Item.ActID))
+			{
+				Act->EntityStateOverrides.Add(EntityID, 0);
+			}
+			Result.AddedEntityCount++;
+		}
+	}
+
+	// Unregister removed actors (another DataLayer of the same Stage may already have removed them)
+	for (int32 EntityID : Item.EntityIDsToRemove)
+	{
+		const TSoftObjectPtr<AActor>* Entity = Stage->EntityRegistry.Find(EntityID);
+		if (Entity && FDataLayerMembershipIndex::ShouldUnregisterEntity(Entity->ToSoftObjectPath(), StageState.ActMemberPaths))
+		{
+			StageState.RegisteredEntityPaths.Remove(Entity->ToSoftObjectPath());
+			Stage->UnregisterEntity(EntityID);
+			Result.RemovedEntityCount++;
+		}
+	}
+
+	return Result;
+}
+
 FDataLayerSyncResult FDataLayerSynchronizer::SyncStageLevelChanges(
 	AStage* Stage,
 	const FDataLayerSyncStatusInfo& StatusInfo,
@@ -249,22 +481,37 @@ FDataLayerSyncResult FDataLayerSynchronizer::SyncStageLevelChanges(
 		return Result;
 	}
 
-	// Handle new child DataLayers -> Create Acts
+	// Resolve new child DataLayers up front so their actors can be bucketed in a single world pass
+	TArray<TPair<UDataLayerAsset*, FString>> NewChildren;
+	TSet<const UDataLayerInstance*> NewChildInstances;
+	UDataLayerManager* Manager = UDataLayerManager::GetDataLayerManager(World);
 	for (const FString& NewChildName : StatusInfo.NewChildDataLayers)
 	{
-		UDataLayerAsset* ChildAsset = FindChildDataLayerAssetByName(Stage->StageDataLayerAsset, NewChildName, World);
-		if (ChildAsset)
+		if (UDataLayerAsset* ChildAsset = FindChildDataLayerAssetByName(Stage->StageDataLayerAsset, NewChildName, World))
 		{
-			// Parse name to get Act name
-			FDataLayerNameParseResult ParseResult = FStageDataLayerNameParser::Parse(ChildAsset->GetName());
-			FString ActName = ParseResult.bIsValid ? ParseResult.ActName : NewChildName;
-
-			if (CreateActFromDataLayer(Stage, ChildAsset, ActName, World))
+			NewChildren.Emplace(ChildAsset, NewChildName);
+			if (const UDataLayerInstance* ChildInstance = Manager ? Manager->GetDataLayerInstance(ChildAsset) : nullptr)
 			{
-				Result.AddedActCount++;
+				NewChildInstances.Add(ChildInstance);
 			}
 		}
 	}
+	const FDataLayerActorBuckets ActorBuckets = FDataLayerMembershipIndex::BucketActorsByDataLayer(World, &NewChildInstances, Stage);
+
+	// Handle new child DataLayers -> Create Acts
+	for (const TPair<UDataLayerAsset*, FString>& NewChild : NewChildren)
+	{
+		UDataLayerAsset* ChildAsset = NewChild.Key;
+
+		// Parse name to get Act name
+		FDataLayerNameParseResult ParseResult = FStageDataLayerNameParser::Parse(ChildAsset->GetName());
+		FString ActName = ParseResult.bIsValid ? ParseResult.ActName : NewChild.Value;
+
+		if (CreateActFromDataLayer(Stage, ChildAsset, ActName, World, &ActorBuckets))
+		{
+			Result.AddedActCount++;
+		}
+	}
 
 	// Handle removed child DataLayers -> Remove Acts
 	// Note: We iterate backwards to safely remove from array
@@ -279,7 +526,7 @@ FDataLayerSyncResult FDataLayerSynchronizer::SyncStageLevelChanges(
 				// Don't remove default Act (index 0)
 				if (i > 0)
 				{
-					Stage->Acts.RemoveAt(i);
+					Stage->RemoveAct(Act.SUID.ActID);
 					Result.RemovedActCount++;
 				}
 				break;
@@ -310,16 +557,6 @@ FDataLayerSyncResult FDataLayerSynchronizer::SyncActLevelChanges(
 	// Get current actors in this DataLayer
 	TArray<AActor*> CurrentActors = GetActorsInDataLayer(ActDataLayer, World);
 
-	// Collect current Entity paths for comparison
-	TSet<FSoftObjectPath> CurrentActorPaths;
-	for (AActor* Actor : CurrentActors)
-	{
-		if (Actor && Actor != Stage)
-		{
-			CurrentActorPaths.Add(FSoftObjectPath(Actor));
-		}
-	}
-
 	// Collect registered Entity paths
 	TSet<FSoftObjectPath> RegisteredEntityPaths;
 	for (const auto& Pair : Stage->EntityRegistry)
@@ -331,35 +568,36 @@ FDataLayerSyncResult FDataLayerSynchronizer::SyncActLevelChanges(
 	}
 
 	// Register new actors as Entitys
+	TArray<AActor*> NewActors;
 	for (AActor* Actor : CurrentActors)
 	{
-		if (Actor && Actor != Stage)
+		if (Actor && Actor != Stage && !RegisteredEntityPaths.Contains(FSoftObjectPath(Actor)))
+		{
+			NewActors.Add(Actor);
+		}
+	}
+
+	for (int32 EntityID : Stage->RegisterEntities(NewActors))
+	{
+		if (EntityID >= 0)
 		{
-			FSoftObjectPath ActorPath(Actor);
-			if (!RegisteredEntityPaths.Contains(ActorPath))
+			// Set default state in this Act
+			if (FAct* Act = Stage->FindActByID(ActID))
 			{
-				int32 EntityID = Stage->RegisterEntity(Actor);
-				if (EntityID >= 0)
-				{
-					// Set default state in this Act
-					if (ActID < Stage->Acts.Num())
-					{
-						Stage->Acts[ActID].EntityStateOverrides.Add(EntityID, 0);
-					}
-					Result.AddedEntityCount++;
-				}
+				Act->EntityStateOverrides.Add(EntityID, 0);
 			}
+			Result.AddedEntityCount++;
 		}
 	}
 
-	// Unregister removed actors
+	// Unregister removed actors (shared rule: only those that left every Act DataLayer of the Stage)
+	const TSet<FSoftObjectPath> StageActMemberPaths = FDataLayerMembershipIndex::Get().CollectStageActMemberPaths(Stage);
 	TArray<int32> EntitysToRemove;
 	for (const auto& Pair : Stage->EntityRegistry)
 	{
 		if (Pair.Value.IsValid())
 		{
-			FSoftObjectPath EntityPath = Pair.Value.ToSoftObjectPath();
-			if (!CurrentActorPaths.Contains(EntityPath))
+			if (FDataLayerMembershipIndex::ShouldUnregisterEntity(Pair.Value.ToSoftObjectPath(), StageActMemberPaths))
 			{
 				EntitysToRemove.Add(Pair.Key);
 			}
@@ -379,7 +617,8 @@ bool FDataLayerSynchronizer::CreateActFromDataLayer(
 	AStage* Stage,
 	UDataLayerAsset* ActDataLayerAsset,
 	const FString& ActName,
-	UWorld* World)
+	UWorld* World,
+	const FDataLayerActorBuckets* ActorBuckets)
 {
 	if (!Stage || !ActDataLayerAsset)
 	{
@@ -393,19 +632,31 @@ bool FDataLayerSynchronizer::CreateActFromDataLayer(
 	NewAct.DisplayName = ActName;
 	NewAct.AssociatedDataLayer = ActDataLayerAsset;
 
-	Stage->Acts.Add(NewAct);
+	Stage->AddAct(NewAct);
 
-	// Register actors in this DataLayer as Entitys
-	TArray<AActor*> ActorsInAct = GetActorsInDataLayer(ActDataLayerAsset, World);
-	for (AActor* Actor : ActorsInAct)
+	// Register actors in this DataLayer as Entitys (reuse the caller's buckets when available)
+	TArray<AActor*> ActorsInAct;
+	if (ActorBuckets)
 	{
-		if (Actor && Actor != Stage)
+		UDataLayerManager* Manager = UDataLayerManager::GetDataLayerManager(World);
+		const UDataLayerInstance* ActInstance = Manager ? Manager->GetDataLayerInstance(ActDataLayerAsset) : nullptr;
+		if (const TArray<AActor*>* Bucket = ActInstance ? ActorBuckets->Find(ActInstance) : nullptr)
 		{
-			int32 EntityID = Stage->RegisterEntity(Actor);
-			if (EntityID >= 0)
-			{
-				Stage->Acts[NewActIndex].EntityStateOverrides.Add(EntityID, 0);
-			}
+			ActorsInAct = *Bucket;
+		}
+	}
+	else
+	{
+		ActorsInAct = GetActorsInDataLayer(ActDataLayerAsset, World);
+	}
+
+	ActorsInAct.RemoveAll([Stage](const AActor* Actor) { return !Actor || Actor == Stage; });
+
+	for (int32 EntityID : Stage->RegisterEntities(ActorsInAct))
+	{
+		if (EntityID >= 0)
+		{
+			Stage->Acts[NewActIndex].EntityStateOverrides.Add(EntityID, 0);
 		}
 	}
 
@@ -429,7 +680,7 @@ bool FDataLayerSynchronizer::RemoveActForDataLayer(
 	{
 		if (Stage->Acts[i].AssociatedDataLayer == RemovedDataLayerAsset)
 		{
-			Stage->Acts.RemoveAt(i);
+			Stage->RemoveAct(Stage->Acts[i].SUID.ActID);
 			return true;
 		}
 	}
@@ -458,17 +709,11 @@ TArray<AActor*> FDataLayerSynchronizer::GetActorsInDataLayer(UDataLayerAsset* As
 		return Result;
 	}
 
-	for (TActorIterator<AActor> It(World); It; ++It)
+	const TSet<const UDataLayerInstance*> InstanceFilter = { Instance };
+	FDataLayerActorBuckets Buckets = FDataLayerMembershipIndex::BucketActorsByDataLayer(World, &InstanceFilter);
+	if (TArray<AActor*>* Bucket = Buckets.Find(Instance))
 	{
-		AActor* Actor = *It;
-		if (Actor && Actor->HasDataLayers())
-		{
-			TArray<const UDataLayerInstance*> ActorDataLayers = Actor->GetDataLayerInstances();
-			if (ActorDataLayers.Contains(Instance))
-			{
-				Result.Add(Actor);
-			}
-		}
+		Result = MoveTemp(*Bucket);
 	}
 
 	return Result;
@@ -187,6 +187,10 @@ void SStageDataLayerOutliner::SubscribeToEvents()
 	// Subscribe to map change events to update when switching levels
 	OnMapChangedHandle = FEditorDelegates::MapChange.AddSP(
 		this, &SStageDataLayerOutliner::OnMapChanged);
+
+	// Subscribe to background sync status results
+	OnSyncStatusUpdatedHandle = FDataLayerSyncStatusCache::Get().OnStatusUpdated().AddSP(
+		this, &SStageDataLayerOutliner::OnSyncStatusUpdated);
 }
 
 void SStageDataLayerOutliner::UnsubscribeFromEvents()
@@ -212,6 +216,13 @@ void SStageDataLayerOutliner::UnsubscribeFromEvents()
 		FEditorDelegates::MapChange.Remove(OnMapChangedHandle);
 		OnMapChangedHandle.Reset();
 	}
+
+	// Unsubscribe from sync status results
+	if (OnSyncStatusUpdatedHandle.IsValid())
+	{
+		FDataLayerSyncStatusCache::Get().OnStatusUpdated().Remove(OnSyncStatusUpdatedHandle);
+		OnSyncStatusUpdatedHandle.Reset();
+	}
 }
 
 //----------------------------------------------------------------
@@ -291,8 +302,8 @@ void SStageDataLayerOutliner::OnDataLayerChanged(
 		FDataLayerSyncStatusCache::Get().InvalidateAll();
 	}
 
-	// Refresh the outliner to show updated sync status
-	RefreshTree();
+	// No RefreshTree() here: FStageDataLayerHierarchy emits coalesced (incremental) hierarchy events,
+	// and the status cells repaint from the cache
 }
 
 void SStageDataLayerOutliner::OnActorDataLayersChanged(const TWeakObjectPtr<AActor>& ChangedActor)
@@ -321,8 +332,22 @@ void SStageDataLayerOutliner::OnActorDataLayersChanged(const TWeakObjectPtr<AAct
 		}
 	}
 
-	// Refresh the outliner to show updated sync status
-	RefreshTree();
+	// Status cells repaint from the cache; the hierarchy handles structural refreshes
+}
+
+void SStageDataLayerOutliner::OnSyncStatusUpdated(const TArray<TWeakObjectPtr<const UDataLayerAsset>>& UpdatedAssets)
+{
+	if (!SceneOutliner.IsValid())
+	{
+		return;
+	}
+
+	// Status/Actions/SUID cells bind to the cache and repaint with the fresh values,
+	// so no tree rebuild is needed. Only a status-sorted view has to re-sort.
+	if (SceneOutliner->GetColumnSortMode(FStageDataLayerSyncStatusColumn::GetID()) != EColumnSortMode::None)
+	{
+		SceneOutliner->RequestSort();
+	}
 }
 
 void SStageDataLayerOutliner::OnMapChanged(uint32 MapChangeFlags)
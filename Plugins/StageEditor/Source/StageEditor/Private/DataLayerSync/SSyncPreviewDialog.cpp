@@ -193,8 +193,8 @@ void SSyncPreviewDialog::CollectSyncTargets()
 			return true;
 		}
 
-		// Get sync status
-		FDataLayerSyncStatusInfo StatusInfo = FDataLayerSyncStatusCache::Get().GetCachedStatus(Asset);
+		// Get sync status (blocking: the dialog needs fresh results, not background-stale ones)
+		FDataLayerSyncStatusInfo StatusInfo = FDataLayerSyncStatusCache::Get().ForceRefresh(Asset);
 
 		// Only process OutOfSync items
 		if (StatusInfo.Status != EDataLayerSyncStatus::OutOfSync)
@@ -609,7 +609,8 @@ FReply SSyncPreviewDialog::OnSyncClicked()
 	if (Result.SyncedCount > 0 || Result.FailedCount > 0)
 	{
 		bSyncExecuted = true;
-		UE_LOG(LogTemp, Log, TEXT("Sync completed: %d synced, %d failed, %d skipped. Changes: %d Acts, %d Entities"),
+		UE_LOG(LogTemp, Log, TEXT("Sync %s: %d synced, %d failed, %d skipped. Changes: %d Acts, %d Entities"),
+			Result.bWasCancelled ? TEXT("cancelled") : TEXT("completed"),
 			Result.SyncedCount, Result.FailedCount, Result.SkippedCount,
 			Result.TotalActChanges, Result.TotalEntityChanges);
 	}
@@ -83,43 +83,75 @@ const TSharedRef<SWidget> FStageDataLayerSyncStatusColumn::ConstructRowWidget(FS
 			return SNullWidget::NullWidget;
 		}
 
-		// Get status from cache - compute once at widget construction time
-		// UI will be rebuilt when events trigger RefreshTree()
-		FDataLayerSyncStatusInfo StatusInfo = FDataLayerSyncStatusCache::Get().GetCachedStatus(DataLayerAsset);
-
-		const FSlateBrush* StatusBrush = nullptr;
-		FSlateColor StatusColor;
-		FText StatusTooltip;
-
-		switch (StatusInfo.Status)
-		{
-		case EDataLayerSyncStatus::Synced:
-			StatusBrush = FAppStyle::GetBrush(TEXT("Icons.Check"));
-			StatusColor = FLinearColor::Green;
-			StatusTooltip = LOCTEXT("StatusSynced", "Synced with Stage/Act");
-			break;
-		case EDataLayerSyncStatus::OutOfSync:
-			StatusBrush = FAppStyle::GetBrush(TEXT("Icons.Warning"));
-			StatusColor = FLinearColor::Yellow;
-			StatusTooltip = FText::Format(LOCTEXT("StatusOutOfSync", "Out of sync: {0}"),
-				FText::FromString(StatusInfo.GetChangeSummary()));
-			break;
-		case EDataLayerSyncStatus::NotImported:
-		default:
-			StatusBrush = FAppStyle::GetBrush(TEXT("Icons.Plus"));
-			StatusColor = FLinearColor(0.3f, 0.7f, 1.0f); // Light blue
-			StatusTooltip = LOCTEXT("StatusNotImported", "Not imported, or associated Stage Actor not loaded (WP streaming)");
-			break;
-		}
+		// Status is read from the cache on paint: stale entries show the last known value (dimmed)
+		// while the cache recomputes in the background, and only this row picks up the fresh result
+		TWeakObjectPtr<const UDataLayerAsset> WeakAsset(DataLayerAsset);
 
 		return SNew(SBox)
 			.HAlign(HAlign_Center)
 			.VAlign(VAlign_Center)
 			[
 				SNew(SImage)
-				.Image(StatusBrush)
-				.ColorAndOpacity(StatusColor)
-				.ToolTipText(StatusTooltip)
+				.Image_Lambda([WeakAsset]() -> const FSlateBrush*
+				{
+					switch (FDataLayerSyncStatusCache::Get().GetCachedStatus(WeakAsset.Get()).Status)
+					{
+					case EDataLayerSyncStatus::Synced:
+						return FAppStyle::GetBrush(TEXT("Icons.Check"));
+					case EDataLayerSyncStatus::OutOfSync:
+						return FAppStyle::GetBrush(TEXT("Icons.Warning"));
+					case EDataLayerSyncStatus::NotImported:
+					default:
+						return FAppStyle::GetBrush(TEXT("Icons.Plus"));
+					}
+				})
+				.ColorAndOpacity_Lambda([WeakAsset]() -> FSlateColor
+				{
+					const FDataLayerSyncStatusInfo StatusInfo = FDataLayerSyncStatusCache::Get().GetCachedStatus(WeakAsset.Get());
+
+					FLinearColor StatusColor;
+					switch (StatusInfo.Status)
+					{
+					case EDataLayerSyncStatus::Synced:
+						StatusColor = FLinearColor::Green;
+						break;
+					case EDataLayerSyncStatus::OutOfSync:
+						StatusColor = FLinearColor::Yellow;
+						break;
+					case EDataLayerSyncStatus::NotImported:
+					default:
+						StatusColor = FLinearColor(0.3f, 0.7f, 1.0f); // Light blue
+						break;
+					}
+
+					return StatusInfo.bIsStale ? StatusColor.CopyWithNewOpacity(0.4f) : StatusColor;
+				})
+				.ToolTipText_Lambda([WeakAsset]() -> FText
+				{
+					const FDataLayerSyncStatusInfo StatusInfo = FDataLayerSyncStatusCache::Get().GetCachedStatus(WeakAsset.Get());
+
+					FText StatusTooltip;
+					switch (StatusInfo.Status)
+					{
+					case EDataLayerSyncStatus::Synced:
+						StatusTooltip = LOCTEXT("StatusSynced", "Synced with Stage/Act");
+						break;
+					case EDataLayerSyncStatus::OutOfSync:
+						StatusTooltip = FText::Format(LOCTEXT("StatusOutOfSync", "Out of sync: {0}"),
+							FText::FromString(StatusInfo.GetChangeSummary()));
+						break;
+					case EDataLayerSyncStatus::NotImported:
+					default:
+						StatusTooltip = LOCTEXT("StatusNotImported", "Not imported, or associated Stage Actor not loaded (WP streaming)");
+						break;
+					}
+
+					if (StatusInfo.bIsStale)
+					{
+						return FText::Format(LOCTEXT("StatusStale", "{0} (updating...)"), StatusTooltip);
+					}
+					return StatusTooltip;
+				})
 			];
 	}
 
@@ -129,6 +161,8 @@ const TSharedRef<SWidget> FStageDataLayerSyncStatusColumn::ConstructRowWidget(FS
 void FStageDataLayerSyncStatusColumn::SortItems(TArray<FSceneOutlinerTreeItemPtr>& OutItems, const EColumnSortMode::Type SortMode) const
 {
 	// Sort by status priority: OutOfSync > NotImported > Synced
+	// Reads never compute synchronously; stale entries sort by their last known value
+	// and the outliner re-sorts when fresh results arrive (see SStageDataLayerOutliner)
 	OutItems.Sort([SortMode](const FSceneOutlinerTreeItemPtr& A, const FSceneOutlinerTreeItemPtr& B)
 	{
 		auto GetStatusPriority = [](const FSceneOutlinerTreeItemPtr& Item) -> int32
@@ -205,9 +239,6 @@ const TSharedRef<SWidget> FStageDataLayerActionsColumn::ConstructRowWidget(FScen
 			return SNullWidget::NullWidget;
 		}
 
-		// Get current status
-		FDataLayerSyncStatusInfo StatusInfo = FDataLayerSyncStatusCache::Get().GetCachedStatus(DataLayerAsset);
-
 		// Parse DataLayer name to determine type
 		FDataLayerNameParseResult ParseResult = FStageDataLayerNameParser::Parse(DataLayerAsset->GetName());
 
@@ -242,21 +273,28 @@ const TSharedRef<SWidget> FStageDataLayerActionsColumn::ConstructRowWidget(FScen
 				];
 		}
 
-		// Show Sync button only for OutOfSync status
-		if (StatusInfo.Status == EDataLayerSyncStatus::OutOfSync)
-		{
-			ButtonBox->AddSlot()
-				.AutoWidth()
-				.Padding(2, 0, 0, 0)
-				[
-					SNew(SButton)
-					.Text(LOCTEXT("SyncButton", "Sync"))
-					.ToolTipText(FText::Format(LOCTEXT("SyncButtonTooltip", "Sync changes: {0}"),
-						FText::FromString(StatusInfo.GetChangeSummary())))
-					.ContentPadding(FMargin(4.f, 1.f))
-					.OnClicked(this, &FStageDataLayerActionsColumn::OnSyncClicked, DataLayerAsset)
-				];
-		}
+		// Show Sync button only for OutOfSync status (evaluated on paint, follows background status updates)
+		TWeakObjectPtr<const UDataLayerAsset> WeakAsset(DataLayerAsset);
+		ButtonBox->AddSlot()
+			.AutoWidth()
+			.Padding(2, 0, 0, 0)
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("SyncButton", "Sync"))
+				.Visibility_Lambda([WeakAsset]() -> EVisibility
+				{
+					return FDataLayerSyncStatusCache::Get().GetCachedStatus(WeakAsset.Get()).Status == EDataLayerSyncStatus::OutOfSync
+						? EVisibility::Visible
+						: EVisibility::Collapsed;
+				})
+				.ToolTipText_Lambda([WeakAsset]() -> FText
+				{
+					return FText::Format(LOCTEXT("SyncButtonTooltip", "Sync changes: {0}"),
+						FText::FromString(FDataLayerSyncStatusCache::Get().GetCachedStatus(WeakAsset.Get()).GetChangeSummary()));
+				})
+				.ContentPadding(FMargin(4.f, 1.f))
+				.OnClicked(this, &FStageDataLayerActionsColumn::OnSyncClicked, DataLayerAsset)
+			];
 
 		return ButtonBox;
 	}
@@ -49,6 +49,13 @@ FStageDataLayerHierarchy::FStageDataLayerHierarchy(FStageDataLayerMode* Mode, co
 
 FStageDataLayerHierarchy::~FStageDataLayerHierarchy()
 {
+	// Drop any pending coalesced events
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
 	// Unsubscribe from engine events
 	if (GEngine)
 	{
@@ -158,9 +165,116 @@ FSceneOutlinerTreeItemPtr FStageDataLayerHierarchy::CreateDataLayerTreeItem(UDat
 
 void FStageDataLayerHierarchy::FullRefreshEvent()
 {
-	FSceneOutlinerHierarchyChangedData EventData;
-	EventData.Type = FSceneOutlinerHierarchyChangedData::FullRefresh;
-	HierarchyChangedEvent.Broadcast(EventData);
+	bPendingFullRefresh = true;
+	SchedulePendingEvents();
+}
+
+void FStageDataLayerHierarchy::QueueAddedEvent(const UDataLayerInstance* DataLayer)
+{
+	PendingRemoved.Remove(FSceneOutlinerTreeItemID(DataLayer));
+	PendingAdded.Add(DataLayer);
+	SchedulePendingEvents();
+}
+
+void FStageDataLayerHierarchy::QueueRemovedEvent(const UDataLayerInstance* DataLayer)
+{
+	// Added and removed in the same frame: the outliner never needs to see it
+	const TWeakObjectPtr<const UDataLayerInstance> WeakDataLayer(DataLayer);
+	if (PendingAdded.Remove(WeakDataLayer) == 0)
+	{
+		PendingRemoved.Add(FSceneOutlinerTreeItemID(DataLayer));
+	}
+	PendingMoved.Remove(WeakDataLayer);
+	SchedulePendingEvents();
+}
+
+void FStageDataLayerHierarchy::QueueMovedEvent(const UDataLayerInstance* DataLayer)
+{
+	// A pending Added item is created with its current parent anyway
+	if (!PendingAdded.Contains(DataLayer))
+	{
+		PendingMoved.Add(DataLayer);
+		SchedulePendingEvents();
+	}
+}
+
+void FStageDataLayerHierarchy::SchedulePendingEvents()
+{
+	if (!FlushTickerHandle.IsValid())
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FStageDataLayerHierarchy::FlushPendingEvents));
+	}
+}
+
+bool FStageDataLayerHierarchy::FlushPendingEvents(float DeltaTime)
+{
+	FlushTickerHandle.Reset();
+
+	if (bPendingFullRefresh)
+	{
+		bPendingFullRefresh = false;
+		PendingAdded.Reset();
+		PendingRemoved.Reset();
+		PendingMoved.Reset();
+
+		FSceneOutlinerHierarchyChangedData EventData;
+		EventData.Type = FSceneOutlinerHierarchyChangedData::FullRefresh;
+		HierarchyChangedEvent.Broadcast(EventData);
+		return false;
+	}
+
+	if (PendingRemoved.Num() > 0)
+	{
+		FSceneOutlinerHierarchyChangedData EventData;
+		EventData.Type = FSceneOutlinerHierarchyChangedData::Removed;
+		EventData.ItemIDs = PendingRemoved.Array();
+		PendingRemoved.Reset();
+		HierarchyChangedEvent.Broadcast(EventData);
+	}
+
+	if (PendingAdded.Num() > 0)
+	{
+		FSceneOutlinerHierarchyChangedData EventData;
+		EventData.Type = FSceneOutlinerHierarchyChangedData::Added;
+		for (const TWeakObjectPtr<const UDataLayerInstance>& WeakDataLayer : PendingAdded)
+		{
+			if (UDataLayerInstance* DataLayer = const_cast<UDataLayerInstance*>(WeakDataLayer.Get()))
+			{
+				if (FSceneOutlinerTreeItemPtr Item = CreateDataLayerTreeItem(DataLayer))
+				{
+					EventData.Items.Add(Item);
+				}
+			}
+		}
+		PendingAdded.Reset();
+
+		if (EventData.Items.Num() > 0)
+		{
+			HierarchyChangedEvent.Broadcast(EventData);
+		}
+	}
+
+	if (PendingMoved.Num() > 0)
+	{
+		FSceneOutlinerHierarchyChangedData EventData;
+		EventData.Type = FSceneOutlinerHierarchyChangedData::Moved;
+		for (const TWeakObjectPtr<const UDataLayerInstance>& WeakDataLayer : PendingMoved)
+		{
+			if (const UDataLayerInstance* DataLayer = WeakDataLayer.Get())
+			{
+				EventData.ItemIDs.Add(FSceneOutlinerTreeItemID(DataLayer));
+			}
+		}
+		PendingMoved.Reset();
+
+		if (EventData.ItemIDs.Num() > 0)
+		{
+			HierarchyChangedEvent.Broadcast(EventData);
+		}
+	}
+
+	return false; // One-shot
 }
 
 //----------------------------------------------------------------
@@ -172,9 +286,36 @@ void FStageDataLayerHierarchy::OnDataLayerChanged(
 	const TWeakObjectPtr<const UDataLayerInstance>& ChangedDataLayer,
 	const FName& ChangedProperty)
 {
-	// Refresh the tree on any DataLayer change
-	// This is simpler and more robust than trying to handle individual add/remove events
-	FullRefreshEvent();
+	// Deleted instances are already marked garbage when the event fires
+	const UDataLayerInstance* DataLayer = ChangedDataLayer.Get(/*bEvenIfPendingKill=*/ true);
+	if (!DataLayer)
+	{
+		// Bulk change (Reset) or unknown instance: rebuild
+		FullRefreshEvent();
+		return;
+	}
+
+	switch (Action)
+	{
+	case EDataLayerAction::Add:
+		QueueAddedEvent(DataLayer);
+		break;
+
+	case EDataLayerAction::Delete:
+		QueueRemovedEvent(DataLayer);
+		break;
+
+	case EDataLayerAction::Rename:
+	case EDataLayerAction::Modify:
+		// Reparenting and renaming move the item (re-sort / new parent); other property
+		// changes are picked up by the row widgets themselves
+		QueueMovedEvent(DataLayer);
+		break;
+
+	default:
+		FullRefreshEvent();
+		break;
+	}
 }
 
 void FStageDataLayerHierarchy::OnActorDataLayersChanged(const TWeakObjectPtr<AActor>& InActor)
@@ -28,6 +28,7 @@
 #include "ClassViewerModule.h"
 #include "DataLayerSync/StageDataLayerNameParser.h"
 #include "DataLayerSync/DataLayerSyncStatusCache.h"
+#include "DataLayerSync/DataLayerMembershipIndex.h"
 #include "ObjectTools.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
@@ -119,7 +120,7 @@ int32 FStageEditorController::CreateNewAct()
 	NewAct.SUID.ActID = NewActID;
 	NewAct.DisplayName = FString::Printf(TEXT("Act_%d"), NewActID);
 
-	Stage->Acts.Add(NewAct);
+	Stage->AddAct(NewAct);
 
 	// Auto-create DataLayer for new Act if World Partition is active
 	if (IsWorldPartitionActive())
@@ -147,7 +148,20 @@ bool FStageEditorController::RegisterEntities(const TArray<AActor*>& ActorsToReg
 	const FScopedTransaction Transaction(LOCTEXT("RegisterEntities", "Register Entitys"));
 	Stage->Modify();
 
-	bool bAnyRegistered = false;
+	// Snapshot already-registered actors once instead of scanning the registry per actor
+	TSet<const AActor*> AlreadyRegistered;
+	AlreadyRegistered.Reserve(Stage->EntityRegistry.Num());
+	for (const auto& Pair : Stage->EntityRegistry)
+	{
+		if (const AActor* RegisteredActor = Pair.Value.Get())
+		{
+			AlreadyRegistered.Add(RegisteredActor);
+		}
+	}
+
+	TArray<AActor*> PendingEntities;
+	PendingEntities.Reserve(ActorsToRegister.Num());
+
 	for (AActor* Actor : ActorsToRegister)
 	{
 		if (!Actor) continue;
@@ -228,33 +242,22 @@ bool FStageEditorController::RegisterEntities(const TArray<AActor*>& ActorsToReg
 			}
 		}
 
-		if (EntityComp)
+		if (EntityComp && !AlreadyRegistered.Contains(Actor))
 		{
-			// Check if already registered (O(N) check for prototype)
-			bool bAlreadyRegistered = false;
-			for (const auto& Pair : Stage->EntityRegistry)
-			{
-				if (Pair.Value.Get() == Actor)
-				{
-					bAlreadyRegistered = true;
-					break;
-				}
-			}
-
-			if (!bAlreadyRegistered)
-			{
-				int32 NewEntityID = Stage->RegisterEntity(Actor);
-				bAnyRegistered = true;
-
-				// NOTE: Entitys are now registered to Stage only, NOT automatically added to any Act.
-				// User can manually add Entitys to Acts via:
-				// 1. Right-click context menu in RegisteredEntitys folder
-				// 2. Drag & drop Entitys onto Acts
-				// This gives users full control over which Entitys belong to which Acts.
-			}
+			AlreadyRegistered.Add(Actor);
+			PendingEntities.Add(Actor);
 		}
 	}
 
+	// Register in bulk so the Stage allocates IDs and updates the Default Act once.
+	// NOTE: Entitys are registered to the Stage (and its Default Act) only, NOT to any other Act.
+	// User can manually add Entitys to Acts via:
+	// 1. Right-click context menu in RegisteredEntitys folder
+	// 2. Drag & drop Entitys onto Acts
+	// This gives users full control over which Entitys belong to which Acts.
+	const bool bAnyRegistered = Stage->RegisterEntities(PendingEntities).ContainsByPredicate(
+		[](int32 EntityID) { return EntityID >= 0; });
+
 	if (bAnyRegistered)
 	{
 		OnModelChanged.Broadcast();
@@ -513,6 +516,7 @@ bool FStageEditorController::SetEntityStateInAct(int32 EntityID, int32 ActID, in
 
 	// Update the state
 	TargetAct->EntityStateOverrides.Add(EntityID, NewState);
+	Stage->MarkEffectiveEntityStatesDirty();
 
 	// Sync with Data Layer
 	SyncEntityToDataLayer(EntityID, ActID);
@@ -645,6 +649,7 @@ bool FStageEditorController::RemoveAllEntitiesFromAct(int32 ActID)
 	}
 
 	TargetAct->EntityStateOverrides.Empty();
+	Stage->MarkEffectiveEntityStatesDirty();
 
 	OnModelChanged.Broadcast();
 	DebugHeader::ShowNotifyInfo(FString::Printf(TEXT("Removed %d Entitys from Act '%s'"), EntityCount, *TargetAct->DisplayName));
@@ -732,6 +737,7 @@ bool FStageEditorController::UnregisterAllEntities()
 	{
 		Act.EntityStateOverrides.Empty();
 	}
+	Stage->MarkEffectiveEntityStatesDirty();
 
 	OnModelChanged.Broadcast();
 	DebugHeader::ShowNotifyInfo(FString::Printf(TEXT("Unregistered %d Entitys from Stage"), EntityCount));
@@ -1111,6 +1117,7 @@ bool FStageEditorController::CreateDataLayerForAct(int32 ActID)
 		if (NewDataLayer)
 		{
 			TargetAct->AssociatedDataLayer = NewDataLayerAsset;
+			Stage->NotifyDataLayersChanged();
 
 			// Set Act DataLayer as child of Stage DataLayer
 			UDataLayerInstance* StageDataLayerInstance = FindStageDataLayerInstance(Stage);
@@ -1158,6 +1165,7 @@ bool FStageEditorController::AssignDataLayerToAct(int32 ActID, UDataLayerAsset*
 	Stage->Modify();
 
 	TargetAct->AssociatedDataLayer = DataLayer;
+	Stage->NotifyDataLayersChanged();
 
 	// Invalidate sync status cache for both Stage and Act DataLayers
 	if (Stage->StageDataLayerAsset)
@@ -1363,6 +1371,7 @@ bool FStageEditorController::CreateDataLayerForStage(AStage* Stage)
 	Stage->Modify();
 	Stage->StageDataLayerAsset = StageDataLayerAsset;
 	Stage->StageDataLayerName = AssetName;
+	Stage->NotifyDataLayersChanged();
 
 	UE_LOG(LogTemp, Log, TEXT("Created Stage DataLayer: %s"), *AssetName);
 	return true;
@@ -1404,6 +1413,7 @@ bool FStageEditorController::DeleteDataLayerForAct(int32 ActID)
 	}
 
 	TargetAct->AssociatedDataLayer = nullptr;
+	Stage->NotifyDataLayersChanged();
 
 	return true;
 }
@@ -1703,7 +1713,40 @@ AStage* FStageEditorController::ImportStageFromDataLayerWithDefaultAct(UDataLaye
 		});
 	}
 
-	// 5. Process DefaultAct and other Acts
+	// 5. Walk the world once and bucket actors by child DataLayerInstance,
+	//    so each Act registers its Entities from its bucket instead of re-scanning the world
+	TSet<const UDataLayerInstance*> ChildInstances;
+	if (Manager)
+	{
+		for (const FChildDataLayerInfo& ChildInfo : ChildDataLayers)
+		{
+			if (const UDataLayerInstance* ChildInstance = Manager->GetDataLayerInstance(ChildInfo.Asset))
+			{
+				ChildInstances.Add(ChildInstance);
+			}
+		}
+	}
+	const FDataLayerActorBuckets ActorBuckets = FDataLayerMembershipIndex::BucketActorsByDataLayer(World, &ChildInstances, NewStage);
+
+	auto RegisterActEntities = [&](int32 ActIndex, const UDataLayerAsset* ActAsset)
+	{
+		const UDataLayerInstance* ActInstance = Manager ? Manager->GetDataLayerInstance(ActAsset) : nullptr;
+		const TArray<AActor*>* ActActors = ActInstance ? ActorBuckets.Find(ActInstance) : nullptr;
+		if (!ActActors)
+		{
+			return;
+		}
+
+		for (int32 EntityID : NewStage->RegisterEntities(*ActActors))
+		{
+			if (EntityID >= 0)
+			{
+				NewStage->Acts[ActIndex].EntityStateOverrides.Add(EntityID, 0);
+			}
+		}
+	};
+
+	// 6. Process DefaultAct and other Acts
 	// DefaultAct (ID=1) is already at Acts[0] from constructor
 	// We need to either update it with selected DataLayer or keep it empty
 
@@ -1719,29 +1762,7 @@ AStage* FStageEditorController::ImportStageFromDataLayerWithDefaultAct(UDataLaye
 		NewStage->Acts[0].SUID = FSUID::MakeActID(NewStage->SUID.StageID, 1); // ActID=1 for DefaultAct
 
 		// Register Entitys for DefaultAct
-		if (Manager)
-		{
-			const UDataLayerInstance* DefaultActInstance = Manager->GetDataLayerInstance(SelectedChild.Asset);
-			if (DefaultActInstance)
-			{
-				for (TActorIterator<AActor> It(World); It; ++It)
-				{
-					AActor* Actor = *It;
-					if (Actor && Actor != NewStage && Actor->HasDataLayers())
-					{
-						TArray<const UDataLayerInstance*> ActorDataLayers = Actor->GetDataLayerInstances();
-						if (ActorDataLayers.Contains(DefaultActInstance))
-						{
-							int32 EntityID = NewStage->RegisterEntity(Actor);
-							if (EntityID >= 0)
-							{
-								NewStage->Acts[0].EntityStateOverrides.Add(EntityID, 0);
-							}
-						}
-					}
-				}
-			}
-		}
+		RegisterActEntities(0, SelectedChild.Asset);
 
 		// Add other child DataLayers as Acts (starting from ActID=2)
 		int32 NextActID = 2;
@@ -1759,32 +1780,10 @@ AStage* FStageEditorController::ImportStageFromDataLayerWithDefaultAct(UDataLaye
 			NewAct.DisplayName = ChildInfo.DisplayName;
 			NewAct.AssociatedDataLayer = ChildInfo.Asset;
 
-			int32 NewActIndex = NewStage->Acts.Add(NewAct);
+			int32 NewActIndex = NewStage->AddAct(NewAct);
 
 			// Register Entitys for this Act
-			if (Manager)
-			{
-				const UDataLayerInstance* ActInstance = Manager->GetDataLayerInstance(ChildInfo.Asset);
-				if (ActInstance)
-				{
-					for (TActorIterator<AActor> It(World); It; ++It)
-					{
-						AActor* Actor = *It;
-						if (Actor && Actor != NewStage && Actor->HasDataLayers())
-						{
-							TArray<const UDataLayerInstance*> ActorDataLayers = Actor->GetDataLayerInstances();
-							if (ActorDataLayers.Contains(ActInstance))
-							{
-								int32 EntityID = NewStage->RegisterEntity(Actor);
-								if (EntityID >= 0)
-								{
-									NewStage->Acts[NewActIndex].EntityStateOverrides.Add(EntityID, 0);
-								}
-							}
-						}
-					}
-				}
-			}
+			RegisterActEntities(NewActIndex, ChildInfo.Asset);
 
 			NextActID++;
 		}
@@ -1800,32 +1799,10 @@ AStage* FStageEditorController::ImportStageFromDataLayerWithDefaultAct(UDataLaye
 			NewAct.DisplayName = ChildInfo.DisplayName;
 			NewAct.AssociatedDataLayer = ChildInfo.Asset;
 
-			int32 NewActIndex = NewStage->Acts.Add(NewAct);
+			int32 NewActIndex = NewStage->AddAct(NewAct);
 
 			// Register Entitys for this Act
-			if (Manager)
-			{
-				const UDataLayerInstance* ActInstance = Manager->GetDataLayerInstance(ChildInfo.Asset);
-				if (ActInstance)
-				{
-					for (TActorIterator<AActor> It(World); It; ++It)
-					{
-						AActor* Actor = *It;
-						if (Actor && Actor != NewStage && Actor->HasDataLayers())
-						{
-							TArray<const UDataLayerInstance*> ActorDataLayers = Actor->GetDataLayerInstances();
-							if (ActorDataLayers.Contains(ActInstance))
-							{
-								int32 EntityID = NewStage->RegisterEntity(Actor);
-								if (EntityID >= 0)
-								{
-									NewStage->Acts[NewActIndex].EntityStateOverrides.Add(EntityID, 0);
-								}
-							}
-						}
-					}
-				}
-			}
+			RegisterActEntities(NewActIndex, ChildInfo.Asset);
 
 			NextActID++;
 		}
@@ -1846,6 +1823,9 @@ AStage* FStageEditorController::ImportStageFromDataLayerWithDefaultAct(UDataLaye
 		});
 	}
 
+	// Stage and Act DataLayers were assigned directly above
+	NewStage->NotifyDataLayersChanged();
+
 	// Refresh controller state
 	FindStageInWorld();
 	OnModelChanged.Broadcast();
@@ -0,0 +1,527 @@
+#pragma region Imports
+#include "EditorUI/SStageTimelineViewer.h"
+#include "StageEditorModule.h"
+
+#include "Algo/BinarySearch.h"
+#include "DesktopPlatformModule.h"
+#include "Framework/Application/SlateApplication.h"
+#include "IDesktopPlatform.h"
+#include "Misc/Paths.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/AppStyle.h"
+#include "Styling/CoreStyle.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SBorder.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Layout/SSplitter.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "SStageTimelineViewer"
+
+#pragma endregion Imports
+
+#pragma region Helper Functions
+
+namespace StageTimelineViewer
+{
+	constexpr float FrameGraphHeight = 80.0f;
+	constexpr float LaneHeight = 16.0f;
+	constexpr float LaneLabelWidth = 140.0f;
+	constexpr float TickWidth = 2.0f;
+
+	/** Frame budget guide lines (60 / 30 fps) */
+	constexpr float BudgetLinesMs[] = { 16.67f, 33.33f };
+
+	FLinearColor GetEventColor(EStageTimelineEventType Type)
+	{
+		switch (Type)
+		{
+		case EStageTimelineEventType::ZoneEnter:                return FLinearColor(0.3f, 0.8f, 1.0f);
+		case EStageTimelineEventType::ZoneExit:                 return FLinearColor(0.2f, 0.4f, 0.6f);
+		case EStageTimelineEventType::StateChange:              return FLinearColor(1.0f, 0.85f, 0.2f);
+		case EStageTimelineEventType::ActActivated:             return FLinearColor(0.3f, 1.0f, 0.3f);
+		case EStageTimelineEventType::ActDeactivated:           return FLinearColor(0.2f, 0.5f, 0.2f);
+		case EStageTimelineEventType::ActDataLayerState:        return FLinearColor(0.8f, 0.4f, 1.0f);
+		case EStageTimelineEventType::DataLayerTransitionBegin: return FLinearColor(1.0f, 0.4f, 0.3f);
+		case EStageTimelineEventType::DataLayerTransitionEnd:   return FLinearColor(0.6f, 0.25f, 0.2f);
+		default:                                                return FLinearColor::White;
+		}
+	}
+}
+
+#pragma endregion Helper Functions
+
+#pragma region Timeline Graph
+
+DECLARE_DELEGATE_OneParam(FOnStageTimelineScrub, double /*Time*/);
+
+/**
+ * @brief Custom-painted frame-time graph plus per-Stage event lanes.
+ * Left click / drag scrubs, mouse wheel zooms around the cursor.
+ */
+class SStageTimelineGraph : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SStageTimelineGraph) {}
+		SLATE_EVENT(FOnStageTimelineScrub, OnScrub)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs)
+	{
+		OnScrub = InArgs._OnScrub;
+	}
+
+	/** Points the graph at a new capture and resets the view range. */
+	void SetCapture(TSharedPtr<const FStageTimelineCapture> InCapture)
+	{
+		Capture = InCapture;
+		LaneIndexByStageID.Reset();
+		LaneStageIDs.Reset();
+		CaptureEnd = 0.0;
+		MaxDeltaMs = 33.33f;
+
+		if (Capture.IsValid())
+		{
+			for (const FStageTimelineEvent& Event : Capture->Events)
+			{
+				LaneStageIDs.AddUnique(Event.StageID);
+				CaptureEnd = FMath::Max(CaptureEnd, Event.Time);
+			}
+			LaneStageIDs.Sort();
+			for (int32 Index = 0; Index < LaneStageIDs.Num(); ++Index)
+			{
+				LaneIndexByStageID.Add(LaneStageIDs[Index], Index);
+			}
+
+			for (const FStageTimelineFrameSample& Sample : Capture->FrameSamples)
+			{
+				CaptureEnd = FMath::Max(CaptureEnd, Sample.Time);
+				MaxDeltaMs = FMath::Max(MaxDeltaMs, Sample.DeltaMs);
+			}
+		}
+
+		ViewStart = 0.0;
+		ViewEnd = FMath::Max(CaptureEnd, 0.001);
+		ScrubTime = 0.0;
+		Invalidate(EInvalidateWidgetReason::LayoutAndVolatility);
+	}
+
+	void SetScrubTime(double InTime)
+	{
+		ScrubTime = InTime;
+		Invalidate(EInvalidateWidgetReason::Paint);
+	}
+
+	//~ Begin SWidget Interface
+	virtual FVector2D ComputeDesiredSize(float) const override
+	{
+		using namespace StageTimelineViewer;
+		return FVector2D(600.0f, FrameGraphHeight + FMath::Max(1, LaneStageIDs.Num()) * LaneHeight + 4.0f);
+	}
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override
+	{
+		using namespace StageTimelineViewer;
+
+		const FVector2D Size = AllottedGeometry.GetLocalSize();
+		const FSlateBrush* WhiteBrush = FAppStyle::GetBrush("WhiteBrush");
+		const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Regular", 8);
+
+		FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(),
+			WhiteBrush, ESlateDrawEffect::None, FLinearColor(0.015f, 0.015f, 0.015f));
+		++LayerId;
+
+		if (!Capture.IsValid())
+		{
+			return LayerId;
+		}
+
+		const float GraphWidth = FMath::Max(1.0f, (float)Size.X - LaneLabelWidth);
+		const double ViewRange = FMath::Max(ViewEnd - ViewStart, 1e-6);
+		auto TimeToX = [&](double Time) { return LaneLabelWidth + (float)((Time - ViewStart) / ViewRange) * GraphWidth; };
+
+		// Frame budget guides
+		for (const float BudgetMs : BudgetLinesMs)
+		{
+			if (BudgetMs > MaxDeltaMs)
+			{
+				continue;
+			}
+			const float Y = FrameGraphHeight * (1.0f - BudgetMs / MaxDeltaMs);
+			TArray<FVector2D> Guide = { FVector2D(LaneLabelWidth, Y), FVector2D(Size.X, Y) };
+			FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), Guide,
+				ESlateDrawEffect::None, FLinearColor(0.3f, 0.3f, 0.3f));
+			FSlateDrawElement::MakeText(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(FVector2f(LaneLabelWidth, 12.0f), FSlateLayoutTransform(FVector2f(4.0f, Y - 6.0f))),
+				FString::Printf(TEXT("%.1f ms"), BudgetMs), Font, ESlateDrawEffect::None, FLinearColor(0.5f, 0.5f, 0.5f));
+		}
+
+		// Frame time polyline: at most one point per pixel column (max delta in the column)
+		const TArray<FStageTimelineFrameSample>& Samples = Capture->FrameSamples;
+		if (Samples.Num() > 1)
+		{
+			const int32 First = FMath::Max(0, Algo::LowerBoundBy(Samples, ViewStart, &FStageTimelineFrameSample::Time) - 1);
+			const int32 Last = FMath::Min(Samples.Num(), Algo::UpperBoundBy(Samples, ViewEnd, &FStageTimelineFrameSample::Time) + 1);
+
+			TArray<FVector2D> Points;
+			Points.Reserve(FMath::Min(Last - First, (int32)GraphWidth * 2));
+
+			int32 Column = INDEX_NONE;
+			float ColumnMax = 0.0f;
+			for (int32 Index = First; Index < Last; ++Index)
+			{
+				const float X = TimeToX(Samples[Index].Time);
+				const int32 SampleColumn = FMath::FloorToInt(X);
+				if (SampleColumn != Column && Column != INDEX_NONE)
+				{
+					Points.Add(FVector2D(Column, FrameGraphHeight * (1.0f - ColumnMax / MaxDeltaMs)));
+					ColumnMax = 0.0f;
+				}
+				Column = SampleColumn;
+				ColumnMax = FMath::Max(ColumnMax, Samples[Index].DeltaMs);
+			}
+			if (Column != INDEX_NONE)
+			{
+				Points.Add(FVector2D(Column, FrameGraphHeight * (1.0f - ColumnMax / MaxDeltaMs)));
+			}
+
+			FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), Points,
+				ESlateDrawEffect::None, FLinearColor(0.9f, 0.6f, 0.1f));
+		}
+		++LayerId;
+
+		// Lane labels and separators
+		for (int32 Lane = 0; Lane < LaneStageIDs.Num(); ++Lane)
+		{
+			const int32 StageID = LaneStageIDs[Lane];
+			const FString* StageName = Capture->StageNames.Find(StageID);
+			const float Y = FrameGraphHeight + Lane * LaneHeight;
+
+			FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+				AllottedGeometry.ToPaintGeometry(FVector2f(Size.X, LaneHeight), FSlateLayoutTransform(FVector2f(0.0f, Y))),
+				WhiteBrush, ESlateDrawEffect::None, (Lane % 2) ? FLinearColor(0.03f, 0.03f, 0.03f) : FLinearColor(0.05f, 0.05f, 0.05f));
+			FSlateDrawElement::MakeText(OutDrawElements, LayerId + 1,
+				AllottedGeometry.ToPaintGeometry(FVector2f(LaneLabelWidth, LaneHeight), FSlateLayoutTransform(FVector2f(4.0f, Y + 1.0f))),
+				StageName ? FString::Printf(TEXT("%s (%d)"), **StageName, StageID) : FString::Printf(TEXT("Stage %d"), StageID),
+				Font, ESlateDrawEffect::None, FLinearColor(0.8f, 0.8f, 0.8f));
+		}
+		LayerId += 2;
+
+		// Event ticks
+		const TArray<FStageTimelineEvent>& Events = Capture->Events;
+		const int32 FirstEvent = Algo::LowerBoundBy(Events, ViewStart, &FStageTimelineEvent::Time);
+		const int32 LastEvent = Algo::UpperBoundBy(Events, ViewEnd, &FStageTimelineEvent::Time);
+		for (int32 Index = FirstEvent; Index < LastEvent; ++Index)
+		{
+			const FStageTimelineEvent& Event = Events[Index];
+			const int32* Lane = LaneIndexByStageID.Find(Event.StageID);
+			if (!Lane)
+			{
+				continue;
+			}
+
+			FSlateDrawElement::MakeBox(OutDrawElements, LayerId,
+				AllottedGeometry.ToPaintGeometry(FVector2f(TickWidth, LaneHeight - 4.0f),
+					FSlateLayoutTransform(FVector2f(TimeToX(Event.Time), FrameGraphHeight + *Lane * LaneHeight + 2.0f))),
+				WhiteBrush, ESlateDrawEffect::None, GetEventColor(Event.Type));
+		}
+		++LayerId;
+
+		// Scrub cursor
+		if (ScrubTime >= ViewStart && ScrubTime <= ViewEnd)
+		{
+			const float X = TimeToX(ScrubTime);
+			TArray<FVector2D> Cursor = { FVector2D(X, 0.0f), FVector2D(X, Size.Y) };
+			FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), Cursor,
+				ESlateDrawEffect::None, FLinearColor::White);
+			FSlateDrawElement::MakeText(OutDrawElements, LayerId,
+				AllottedGeometry.ToPaintGeometry(FVector2f(80.0f, 12.0f), FSlateLayoutTransform(FVector2f(X + 3.0f, 2.0f))),
+				FString::Printf(TEXT("%.3fs"), ScrubTime), Font, ESlateDrawEffect::None, FLinearColor::White);
+		}
+
+		return LayerId;
+	}
+
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override
+	{
+		if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton || !Capture.IsValid())
+		{
+			return FReply::Unhandled();
+		}
+
+		ScrubToScreenPosition(MyGeometry, MouseEvent.GetScreenSpacePosition());
+		return FReply::Handled().CaptureMouse(SharedThis(this));
+	}
+
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override
+	{
+		if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton && HasMouseCapture())
+		{
+			return FReply::Handled().ReleaseMouseCapture();
+		}
+		return FReply::Unhandled();
+	}
+
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override
+	{
+		if (HasMouseCapture())
+		{
+			ScrubToScreenPosition(MyGeometry, MouseEvent.GetScreenSpacePosition());
+			return FReply::Handled();
+		}
+		return FReply::Unhandled();
+	}
+
+	virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override
+	{
+		if (!Capture.IsValid() || CaptureEnd <= 0.0)
+		{
+			return FReply::Unhandled();
+		}
+
+		// Zoom around the time under the cursor, clamped to the capture range
+		const double Pivot = LocalXToTime(MyGeometry, MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()).X);
+		const double Scale = MouseEvent.GetWheelDelta() > 0.0f ? 0.8 : 1.25;
+		const double NewRange = FMath::Clamp((ViewEnd - ViewStart) * Scale, 0.01, CaptureEnd);
+
+		const double Alpha = (Pivot - ViewStart) / FMath::Max(ViewEnd - ViewStart, 1e-6);
+		ViewStart = FMath::Clamp(Pivot - Alpha * NewRange, 0.0, CaptureEnd - NewRange);
+		ViewEnd = ViewStart + NewRange;
+
+		Invalidate(EInvalidateWidgetReason::Paint);
+		return FReply::Handled();
+	}
+	//~ End SWidget Interface
+
+private:
+	double LocalXToTime(const FGeometry& MyGeometry, float LocalX) const
+	{
+		using namespace StageTimelineViewer;
+		const float GraphWidth = FMath::Max(1.0f, (float)MyGeometry.GetLocalSize().X - LaneLabelWidth);
+		const double Alpha = FMath::Clamp((LocalX - LaneLabelWidth) / GraphWidth, 0.0f, 1.0f);
+		return ViewStart + Alpha * (ViewEnd - ViewStart);
+	}
+
+	void ScrubToScreenPosition(const FGeometry& MyGeometry, const FVector2D& ScreenPosition)
+	{
+		SetScrubTime(LocalXToTime(MyGeometry, MyGeometry.AbsoluteToLocal(ScreenPosition).X));
+		OnScrub.ExecuteIfBound(ScrubTime);
+	}
+
+	TSharedPtr<const FStageTimelineCapture> Capture;
+	FOnStageTimelineScrub OnScrub;
+
+	/** Lane order (sorted StageIDs) and reverse lookup */
+	TArray<int32> LaneStageIDs;
+	TMap<int32, int32> LaneIndexByStageID;
+
+	double CaptureEnd = 0.0;
+	double ViewStart = 0.0;
+	double ViewEnd = 1.0;
+	double ScrubTime = 0.0;
+
+	/** Frame graph vertical scale */
+	float MaxDeltaMs = 33.33f;
+};
+
+#pragma endregion Timeline Graph
+
+#pragma region Construction
+
+void SStageTimelineViewer::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+
+		// Toolbar
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.Text(LOCTEXT("OpenCapture", "Open Capture..."))
+				.ToolTipText(LOCTEXT("OpenCaptureTooltip", "Open a .stagerec file written by 'Stage.Record Dump'"))
+				.OnClicked(this, &SStageTimelineViewer::OnOpenCaptureClicked)
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			.Padding(8.0f, 0.0f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SStageTimelineViewer::GetInfoText)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SNew(SSplitter)
+			.Orientation(Orient_Vertical)
+
+			// Graph
+			+ SSplitter::Slot()
+			.Value(0.55f)
+			[
+				SNew(SBorder)
+				.BorderImage(FAppStyle::GetBrush("ToolPanel.GroupBorder"))
+				[
+					SNew(SScrollBox)
+					+ SScrollBox::Slot()
+					[
+						SAssignNew(Graph, SStageTimelineGraph)
+						.OnScrub(this, &SStageTimelineViewer::OnScrubTimeChanged)
+					]
+				]
+			]
+
+			// Events leading up to the scrub time
+			+ SSplitter::Slot()
+			.Value(0.45f)
+			[
+				SAssignNew(EventListView, SListView<TSharedPtr<int32>>)
+				.ListItemsSource(&EventListItems)
+				.OnGenerateRow(this, &SStageTimelineViewer::OnGenerateEventRow)
+				.SelectionMode(ESelectionMode::Single)
+			]
+		]
+	];
+}
+
+#pragma endregion Construction
+
+#pragma region Core API
+
+bool SStageTimelineViewer::LoadCapture(const FString& Filename)
+{
+	TSharedPtr<FStageTimelineCapture> NewCapture = MakeShared<FStageTimelineCapture>();
+	if (!NewCapture->LoadFromFile(Filename))
+	{
+		UE_LOG(LogStageEditor, Warning, TEXT("Stage Timeline: Failed to load capture '%s'"), *Filename);
+		return false;
+	}
+
+	Capture = NewCapture;
+	CaptureFilename = Filename;
+	ScrubTime = 0.0;
+
+	Graph->SetCapture(Capture);
+	RebuildEventList();
+	return true;
+}
+
+#pragma endregion Core API
+
+#pragma region Callbacks
+
+FReply SStageTimelineViewer::OnOpenCaptureClicked()
+{
+	IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+	if (!DesktopPlatform)
+	{
+		return FReply::Handled();
+	}
+
+	const FString DefaultPath = FPaths::ProfilingDir() / TEXT("StageRecordings");
+	const FString FileTypes = FString::Printf(TEXT("Stage Timeline Capture (*%s)|*%s"),
+		FStageTimelineCapture::FileExtension, FStageTimelineCapture::FileExtension);
+
+	TArray<FString> Filenames;
+	const bool bOpened = DesktopPlatform->OpenFileDialog(
+		FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+		LOCTEXT("OpenCaptureDialogTitle", "Open Stage Timeline Capture").ToString(),
+		DefaultPath,
+		FString(),
+		FileTypes,
+		EFileDialogFlags::None,
+		Filenames);
+
+	if (bOpened && Filenames.Num() > 0)
+	{
+		LoadCapture(Filenames[0]);
+	}
+
+	return FReply::Handled();
+}
+
+void SStageTimelineViewer::OnScrubTimeChanged(double NewTime)
+{
+	ScrubTime = NewTime;
+	RebuildEventList();
+}
+
+TSharedRef<ITableRow> SStageTimelineViewer::OnGenerateEventRow(TSharedPtr<int32> EventIndex, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	FString Description;
+	FLinearColor Color = FLinearColor::White;
+	if (Capture.IsValid() && EventIndex.IsValid() && Capture->Events.IsValidIndex(*EventIndex))
+	{
+		const FStageTimelineEvent& Event = Capture->Events[*EventIndex];
+		Description = Capture->DescribeEvent(Event);
+		Color = StageTimelineViewer::GetEventColor(Event.Type);
+	}
+
+	return SNew(STableRow<TSharedPtr<int32>>, OwnerTable)
+		[
+			SNew(STextBlock)
+			.Text(FText::FromString(Description))
+			.ColorAndOpacity(FSlateColor(Color))
+			.Font(FCoreStyle::GetDefaultFontStyle("Mono", 9))
+		];
+}
+
+#pragma endregion Callbacks
+
+#pragma region Helpers
+
+void SStageTimelineViewer::RebuildEventList()
+{
+	EventListItems.Reset();
+
+	if (Capture.IsValid())
+	{
+		const int32 End = Algo::UpperBoundBy(Capture->Events, ScrubTime, &FStageTimelineEvent::Time);
+		for (int32 Index = FMath::Max(0, End - MaxListedEvents); Index < End; ++Index)
+		{
+			EventListItems.Add(MakeShared<int32>(Index));
+		}
+	}
+
+	EventListView->RequestListRefresh();
+	if (EventListItems.Num() > 0)
+	{
+		EventListView->RequestScrollIntoView(EventListItems.Last());
+	}
+}
+
+FText SStageTimelineViewer::GetInfoText() const
+{
+	if (!Capture.IsValid())
+	{
+		return LOCTEXT("NoCapture", "No capture loaded. Record one in game with 'Stage.Record Start' / 'Stage.Record Dump'.");
+	}
+
+	// Frame sample at (or just before) the scrub time
+	FString FrameInfo;
+	const int32 SampleIndex = Algo::UpperBoundBy(Capture->FrameSamples, ScrubTime, &FStageTimelineFrameSample::Time) - 1;
+	if (Capture->FrameSamples.IsValidIndex(SampleIndex))
+	{
+		const FStageTimelineFrameSample& Sample = Capture->FrameSamples[SampleIndex];
+		FrameInfo = FString::Printf(TEXT("  |  %.3fs  frame #%llu  %.2f ms"), ScrubTime, Sample.Frame, Sample.DeltaMs);
+	}
+
+	return FText::FromString(FString::Printf(TEXT("%s  (%s)  %d events, %d frames, %d Stages%s"),
+		*FPaths::GetCleanFilename(CaptureFilename), *Capture->WorldName,
+		Capture->Events.Num(), Capture->FrameSamples.Num(), Capture->StageNames.Num(), *FrameInfo));
+}
+
+#pragma endregion Helpers
+
+#undef LOCTEXT_NAMESPACE
@@ -21,6 +21,7 @@
 #include "Misc/MessageDialog.h"
 #include "WorldPartition/DataLayer/DataLayerAsset.h"
 #include "UObject/ObjectSaveContext.h"
+#include "UObject/ObjectKey.h"
 
 #define LOCTEXT_NAMESPACE "SStageEditorPanel"
 
@@ -59,7 +60,7 @@ void SStageEditorPanel::Construct(const FArguments& InArgs, TSharedPtr<FStageEdi
 	// Bind to Controller updates
 	if (Controller.IsValid())
 	{
-		Controller->OnModelChanged.AddSP(this, &SStageEditorPanel::RefreshUI);
+		Controller->OnModelChanged.AddSP(this, &SStageEditorPanel::RequestRefreshUI);
 	}
 	
 	// Create Creation Settings struct
@@ -413,7 +414,7 @@ void SStageEditorPanel::OnStageDataChanged(AStage* Stage)
 		// Rescan the world for stages in case new ones were created
 		Controller->FindStageInWorld();
 	}
-	RefreshUI();
+	RequestRefreshUI();
 }
 
 void SStageEditorPanel::CheckAndRefreshWorldPartitionStatus()
@@ -452,6 +453,9 @@ void SStageEditorPanel::RebuildUI()
 	// We need to preserve the Controller reference
 	TSharedPtr<FStageEditorController> SavedController = Controller;
 
+	// New TreeView: drop old items so the first refresh applies default expansion
+	RootTreeItems.Reset();
+
 	// Build new arguments
 	FArguments Args;
 
@@ -467,6 +471,25 @@ void SStageEditorPanel::RebuildUI()
 
 #pragma region Core API
 
+void SStageEditorPanel::RequestRefreshUI()
+{
+	// Coalesce bursts of OnModelChanged into a single refresh on the next Slate tick
+	if (bRefreshUIPending)
+	{
+		return;
+	}
+
+	bRefreshUIPending = true;
+	RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SStageEditorPanel::HandleDeferredRefreshUI));
+}
+
+EActiveTimerReturnType SStageEditorPanel::HandleDeferredRefreshUI(double InCurrentTime, float InDeltaTime)
+{
+	bRefreshUIPending = false;
+	RefreshUI();
+	return EActiveTimerReturnType::Stop;
+}
+
 void SStageEditorPanel::RefreshUI()
 {
 	if (!Controller.IsValid()) return;
@@ -477,12 +500,21 @@ void SStageEditorPanel::RefreshUI()
 		return;
 	}
 
-	// Save Expansion State
-	TSet<FString> ExpansionState;
-	SaveExpansionState(ExpansionState);
+	const bool bFirstPopulation = RootTreeItems.Num() == 0;
+
+	// Previous Stage items, keyed by Stage actor, so they can be patched in place.
+	// Reusing items keeps TreeView selection/expansion (both keyed by item pointer).
+	TMap<TObjectKey<AStage>, TSharedPtr<FStageTreeItem>> PreviousStageItems;
+	for (const TSharedPtr<FStageTreeItem>& StageItem : RootTreeItems)
+	{
+		if (StageItem.IsValid() && StageItem->StagePtr.IsValid())
+		{
+			PreviousStageItems.Add(StageItem->StagePtr.Get(), StageItem);
+		}
+	}
 
-	RootTreeItems.Empty();
-	ActorPathToTreeItem.Empty();
+	TArray<TSharedPtr<FStageTreeItem>> NewRootItems;
+	bool bRowContentChanged = false;
 
 	const TArray<TWeakObjectPtr<AStage>>& FoundStages = Controller->GetFoundStages();
 
@@ -490,100 +522,184 @@ void SStageEditorPanel::RefreshUI()
 	{
 		if (AStage* Stage = StagePtr.Get())
 		{
-			// Create Stage Root Item - DisplayName stores label for other uses (e.g., drag text)
-			FString StageName = Stage->GetActorLabel();
-			TSharedPtr<FStageTreeItem> StageItem = MakeShared<FStageTreeItem>(EStageTreeItemType::Stage, StageName, Stage->GetStageID(), nullptr, Stage);
-			StageItem->ActorPtr = Stage;
-			StageItem->ActorPath = Stage->GetPathName();
-			RootTreeItems.Add(StageItem);
-			if (!StageItem->ActorPath.IsEmpty())
+			TSharedPtr<FStageTreeItem> StageItem;
+			const bool bNewStage = !PreviousStageItems.RemoveAndCopyValue(Stage, StageItem);
+			if (bNewStage)
 			{
-				ActorPathToTreeItem.Add(StageItem->ActorPath, StageItem);
+				StageItem = MakeShared<FStageTreeItem>(EStageTreeItemType::Stage, FString(), Stage->GetStageID(), nullptr, Stage);
 			}
 
-			// 1. Create "Acts" Folder
-			TSharedPtr<FStageTreeItem> ActsFolder = MakeShared<FStageTreeItem>(EStageTreeItemType::ActsFolder, TEXT("Acts"));
-			StageItem->Children.Add(ActsFolder);
-			ActsFolder->Parent = StageItem;
+			bRowContentChanged |= ReconcileStageItem(StageItem, Stage) && !bNewStage;
+			NewRootItems.Add(StageItem);
 
-			// Populate Acts
-			for (FAct& Act : Stage->Acts)
+			// Default expansion for first load
+			if (bNewStage && bFirstPopulation)
 			{
-				// DisplayName stores the user-friendly name for other uses (e.g., context menu, drag text)
-				TSharedPtr<FStageTreeItem> ActItem = MakeShared<FStageTreeItem>(EStageTreeItemType::Act, Act.DisplayName, Act.SUID.ActID);
-				ActsFolder->Children.Add(ActItem);
-				ActItem->Parent = ActsFolder;
-
-				// Populate Entities in Act
-				for (auto& Pair : Act.EntityStateOverrides)
-				{
-					int32 EntityID = Pair.Key;
-					int32 State = Pair.Value;
-
-					AActor* EntityActor = Stage->GetEntityByID(EntityID);
-					// DisplayName stores actor label for other uses
-					FString EntityDisplayName = EntityActor ? EntityActor->GetActorLabel() : TEXT("Invalid Entity");
-
-					TSharedPtr<FStageTreeItem> EntityItem = MakeShared<FStageTreeItem>(EStageTreeItemType::Entity, EntityDisplayName, EntityID, EntityActor);
-					ActItem->Children.Add(EntityItem);
-					EntityItem->Parent = ActItem;
-					EntityItem->StagePtr = Stage;
-					EntityItem->EntityState = State;
-					EntityItem->bHasEntityState = true;
-					if (EntityActor)
-					{
-						EntityItem->ActorPath = EntityActor->GetPathName();
-						if (!EntityItem->ActorPath.IsEmpty() && !ActorPathToTreeItem.Contains(EntityItem->ActorPath))
-						{
-							ActorPathToTreeItem.Add(EntityItem->ActorPath, EntityItem);
-						}
-					}
-				}
+				StageTreeView->SetItemExpansion(StageItem, true);
 			}
+		}
+	}
 
-			// 2. Create "Registered Entities" Folder
-			TSharedPtr<FStageTreeItem> EntitiesFolder = MakeShared<FStageTreeItem>(EStageTreeItemType::EntitiesFolder, TEXT("Registered Entities"));
-			StageItem->Children.Add(EntitiesFolder);
-			EntitiesFolder->Parent = StageItem;
+	RootTreeItems = MoveTemp(NewRootItems);
 
-			// Populate All Entities
-			for (auto& Pair : Stage->EntityRegistry)
+	// Rebuild the selection-sync index from the (mostly reused) items
+	// (object keys: no per-item path strings; the first item found for an actor wins)
+	ActorToTreeItem.Reset();
+	UnloadedActorPathToTreeItem.Reset();
+	TArray<TSharedPtr<FStageTreeItem>> Stack = RootTreeItems;
+	while (Stack.Num() > 0)
+	{
+		TSharedPtr<FStageTreeItem> Current = Stack.Pop(EAllowShrinking::No);
+		if (AActor* Actor = Current->ActorPtr.Get())
+		{
+			if (!ActorToTreeItem.Contains(Actor))
 			{
-				if (AActor* Actor = Pair.Value.Get())
-				{
-					// DisplayName stores actor label for other uses
-					FString EntityDisplayName = Actor->GetActorLabel();
-					TSharedPtr<FStageTreeItem> EntityItem = MakeShared<FStageTreeItem>(EStageTreeItemType::Entity, EntityDisplayName, Pair.Key, Actor);
-					EntitiesFolder->Children.Add(EntityItem);
-					EntityItem->Parent = EntitiesFolder;
-					EntityItem->StagePtr = Stage;
-					EntityItem->ActorPath = Actor->GetPathName();
-					if (!EntityItem->ActorPath.IsEmpty() && !ActorPathToTreeItem.Contains(EntityItem->ActorPath))
-					{
-						ActorPathToTreeItem.Add(EntityItem->ActorPath, EntityItem);
-					}
-				}
+				ActorToTreeItem.Add(Actor, Current);
 			}
 		}
+		else if (Current->ActorPath.IsValid() && !UnloadedActorPathToTreeItem.Contains(Current->ActorPath))
+		{
+			UnloadedActorPathToTreeItem.Add(Current->ActorPath, Current);
+		}
+		Stack.Append(Current->Children);
 	}
 
-	StageTreeView->RequestTreeRefresh();
-	
-	// Restore Expansion State
-	if (ExpansionState.Num() > 0)
+	// Rows cache their text/state at construction: regenerate the (visible) rows only when
+	// an existing item changed, otherwise just re-gather the structure
+	if (bRowContentChanged)
 	{
-		RestoreExpansionState(ExpansionState);
+		StageTreeView->RebuildList();
 	}
 	else
 	{
-		// Default expansion for first load
-		for (const auto& Item : RootTreeItems)
+		StageTreeView->RequestTreeRefresh();
+	}
+
+	// HandleViewportSelectionChanged(nullptr);
+}
+
+bool SStageEditorPanel::ReconcileStageItem(const TSharedPtr<FStageTreeItem>& StageItem, AStage* Stage)
+{
+	// DisplayName stores label for other uses (e.g., drag text)
+	bool bChanged = PatchTreeItem(*StageItem, Stage->GetActorLabel(), Stage->GetStageID(), Stage, Stage);
+
+	// Folders are fixed: [0] Acts, [1] Registered Entities
+	if (StageItem->Children.Num() != 2)
+	{
+		StageItem->Children.Reset();
+
+		TSharedPtr<FStageTreeItem> NewActsFolder = MakeShared<FStageTreeItem>(EStageTreeItemType::ActsFolder, TEXT("Acts"));
+		NewActsFolder->Parent = StageItem;
+		StageItem->Children.Add(NewActsFolder);
+
+		TSharedPtr<FStageTreeItem> NewEntitiesFolder = MakeShared<FStageTreeItem>(EStageTreeItemType::EntitiesFolder, TEXT("Registered Entities"));
+		NewEntitiesFolder->Parent = StageItem;
+		StageItem->Children.Add(NewEntitiesFolder);
+	}
+
+	const TSharedPtr<FStageTreeItem>& ActsFolder = StageItem->Children[0];
+	const TSharedPtr<FStageTreeItem>& EntitiesFolder = StageItem->Children[1];
+
+	// 1. Acts (keyed by ActID) and their Entities (keyed by EntityID)
+	TMap<int32, TSharedPtr<FStageTreeItem>> PreviousActs = IndexChildrenByID(ActsFolder);
+	ActsFolder->Children.Reset();
+
+	for (FAct& Act : Stage->Acts)
+	{
+		TSharedPtr<FStageTreeItem> ActItem = TakeOrCreateChild(PreviousActs, ActsFolder, EStageTreeItemType::Act, Act.SUID.ActID);
+		// DisplayName stores the user-friendly name for other uses (e.g., context menu, drag text)
+		bChanged |= PatchTreeItem(*ActItem, Act.DisplayName, Act.SUID.ActID, nullptr, nullptr);
+
+		TMap<int32, TSharedPtr<FStageTreeItem>> PreviousEntities = IndexChildrenByID(ActItem);
+		ActItem->Children.Reset();
+
+		for (auto& Pair : Act.EntityStateOverrides)
 		{
-			StageTreeView->SetItemExpansion(Item, true);
+			int32 EntityID = Pair.Key;
+			int32 State = Pair.Value;
+
+			const TSoftObjectPtr<AActor>* EntityPtr = Stage->EntityRegistry.Find(EntityID);
+			AActor* EntityActor = EntityPtr ? EntityPtr->Get() : nullptr;
+			// DisplayName stores actor label for other uses
+			FString EntityDisplayName = EntityActor ? EntityActor->GetActorLabel() : TEXT("Invalid Entity");
+
+			// Unloaded (WP) actors keep their soft path so selection sync can still find them once loaded
+			const FSoftObjectPath UnloadedActorPath = (!EntityActor && EntityPtr) ? EntityPtr->ToSoftObjectPath() : FSoftObjectPath();
+
+			TSharedPtr<FStageTreeItem> EntityItem = TakeOrCreateChild(PreviousEntities, ActItem, EStageTreeItemType::Entity, EntityID);
+			bChanged |= PatchTreeItem(*EntityItem, EntityDisplayName, EntityID, EntityActor, Stage, State, true, UnloadedActorPath);
 		}
 	}
 
-	// HandleViewportSelectionChanged(nullptr);
+	// 2. Registered Entities (keyed by EntityID)
+	TMap<int32, TSharedPtr<FStageTreeItem>> PreviousRegistered = IndexChildrenByID(EntitiesFolder);
+	EntitiesFolder->Children.Reset();
+
+	for (auto& Pair : Stage->EntityRegistry)
+	{
+		if (AActor* Actor = Pair.Value.Get())
+		{
+			TSharedPtr<FStageTreeItem> EntityItem = TakeOrCreateChild(PreviousRegistered, EntitiesFolder, EStageTreeItemType::Entity, Pair.Key);
+			bChanged |= PatchTreeItem(*EntityItem, Actor->GetActorLabel(), Pair.Key, Actor, Stage);
+		}
+	}
+
+	return bChanged;
+}
+
+TMap<int32, TSharedPtr<FStageTreeItem>> SStageEditorPanel::IndexChildrenByID(const TSharedPtr<FStageTreeItem>& ParentItem)
+{
+	TMap<int32, TSharedPtr<FStageTreeItem>> Result;
+	Result.Reserve(ParentItem->Children.Num());
+	for (const TSharedPtr<FStageTreeItem>& Child : ParentItem->Children)
+	{
+		Result.Add(Child->ID, Child);
+	}
+	return Result;
+}
+
+TSharedPtr<FStageTreeItem> SStageEditorPanel::TakeOrCreateChild(TMap<int32, TSharedPtr<FStageTreeItem>>& PreviousChildren,
+	const TSharedPtr<FStageTreeItem>& ParentItem, EStageTreeItemType Type, int32 ID)
+{
+	TSharedPtr<FStageTreeItem> Child;
+	if (!PreviousChildren.RemoveAndCopyValue(ID, Child))
+	{
+		Child = MakeShared<FStageTreeItem>(Type, FString(), ID);
+		Child->Parent = ParentItem;
+	}
+
+	ParentItem->Children.Add(Child);
+	return Child;
+}
+
+bool SStageEditorPanel::PatchTreeItem(FStageTreeItem& Item, const FString& DisplayName, int32 ID, AActor* Actor, AStage* Stage,
+	int32 EntityState, bool bHasEntityState, const FSoftObjectPath& UnloadedActorPath)
+{
+	bool bChanged = false;
+
+	if (Item.ID != ID) { Item.ID = ID; bChanged = true; }
+	if (!Item.DisplayName.Equals(DisplayName, ESearchCase::CaseSensitive)) { Item.DisplayName = DisplayName; bChanged = true; }
+	if (Item.StagePtr.Get() != Stage) { Item.StagePtr = Stage; bChanged = true; }
+	if (Item.EntityState != EntityState || Item.bHasEntityState != bHasEntityState)
+	{
+		Item.EntityState = EntityState;
+		Item.bHasEntityState = bHasEntityState;
+		bChanged = true;
+	}
+
+	if (Item.ActorPtr.Get() != Actor)
+	{
+		Item.ActorPtr = Actor;
+		bChanged = true;
+	}
+
+	// Not displayed by the row; only used for selection sync of unloaded actors
+	if (Item.ActorPath != UnloadedActorPath)
+	{
+		Item.ActorPath = UnloadedActorPath;
+	}
+
+	return bChanged;
 }
 #pragma endregion Core API
 
@@ -2748,58 +2864,6 @@ FReply SStageEditorPanel::OnRowDrop(const FGeometry& MyGeometry, const FDragDrop
 
 #pragma region Private Helpers
 
-FString SStageEditorPanel::GetItemHash(TSharedPtr<FStageTreeItem> Item)
-{
-	if (!Item.IsValid()) return TEXT("");
-
-	FString Hash = FString::Printf(TEXT("%d_%s"), (int32)Item->Type, *Item->DisplayName);
-	
-	if (Item->Parent.IsValid())
-	{
-		Hash = GetItemHash(Item->Parent.Pin()) + TEXT("/") + Hash;
-	}
-	
-	return Hash;
-}
-
-void SStageEditorPanel::SaveExpansionState(TSet<FString>& OutExpansionState)
-{
-	OutExpansionState.Empty();
-	if (!StageTreeView.IsValid()) return;
-
-	// Traverse all items to check expansion (recursive helper or iterative)
-	// Since STreeView doesn't expose a simple "GetExpandedItems", we iterate our known RootTreeItems and their children
-	
-	TArray<TSharedPtr<FStageTreeItem>> Stack = RootTreeItems;
-	while (Stack.Num() > 0)
-	{
-		TSharedPtr<FStageTreeItem> Current = Stack.Pop();
-		if (StageTreeView->IsItemExpanded(Current))
-		{
-			OutExpansionState.Add(GetItemHash(Current));
-			Stack.Append(Current->Children);
-		}
-	}
-}
-
-void SStageEditorPanel::RestoreExpansionState(const TSet<FString>& InExpansionState)
-{
-	if (!StageTreeView.IsValid()) return;
-
-	TArray<TSharedPtr<FStageTreeItem>> Stack = RootTreeItems;
-	while (Stack.Num() > 0)
-	{
-		TSharedPtr<FStageTreeItem> Current = Stack.Pop();
-		FString Hash = GetItemHash(Current);
-		
-		if (InExpansionState.Contains(Hash))
-		{
-			StageTreeView->SetItemExpansion(Current, true);
-			Stack.Append(Current->Children);
-		}
-	}
-}
-
 /**
  * @brief Checks if an item is the drag target or one of its descendants
  * @param Item The item to check
@@ -2958,26 +3022,27 @@ void SStageEditorPanel::HandleViewportSelectionChanged(UObject* SelectedObject)
 		return;
 	}
 
-	const FString ActorPath = SelectedActor->GetPathName();
-	if (ActorPath.IsEmpty())
+	// Object-key lookup; the soft path is only built when unloaded (WP) entities are in the tree
+	TWeakPtr<FStageTreeItem> FoundItem;
+	if (const TWeakPtr<FStageTreeItem>* ItemPtr = ActorToTreeItem.Find(SelectedActor))
 	{
-		return;
+		FoundItem = *ItemPtr;
 	}
-
-	if (TWeakPtr<FStageTreeItem>* ItemPtr = ActorPathToTreeItem.Find(ActorPath))
+	else if (UnloadedActorPathToTreeItem.Num() > 0)
 	{
-		if (TSharedPtr<FStageTreeItem> TreeItem = ItemPtr->Pin())
-		{
-			ExpandAncestors(TreeItem);
-			TGuardValue<bool> Guard(bUpdatingTreeSelectionFromViewport, true);
-			StageTreeView->SetSelection(TreeItem);
-			StageTreeView->RequestScrollIntoView(TreeItem);
-		}
-		else
+		if (const TWeakPtr<FStageTreeItem>* PathItemPtr = UnloadedActorPathToTreeItem.Find(FSoftObjectPath(SelectedActor)))
 		{
-			ActorPathToTreeItem.Remove(ActorPath);
+			FoundItem = *PathItemPtr;
 		}
 	}
+
+	if (TSharedPtr<FStageTreeItem> TreeItem = FoundItem.Pin())
+	{
+		ExpandAncestors(TreeItem);
+		TGuardValue<bool> Guard(bUpdatingTreeSelectionFromViewport, true);
+		StageTreeView->SetSelection(TreeItem);
+		StageTreeView->RequestScrollIntoView(TreeItem);
+	}
 }
 
 void SStageEditorPanel::ExpandAncestors(TSharedPtr<FStageTreeItem> Item)
@@ -3,8 +3,10 @@
 #include "CustomStyle/StageEditorStyle.h"
 #include "DataLayerSync/SStageDataLayerOutliner.h"
 #include "DataLayerSync/DataLayerSyncStatusCache.h"
+#include "DataLayerSync/DataLayerMembershipIndex.h"
 #include "EditorLogic/StageEditorController.h"
 #include "EditorUI/StageEditorPanel.h"
+#include "EditorUI/SStageTimelineViewer.h"
 #include "ToolMenus.h"
 #include "Widgets/Docking/SDockTab.h"
 #include "WorkspaceMenuStructure.h"
@@ -16,6 +18,7 @@ DEFINE_LOG_CATEGORY(LogStageEditor);
 
 const FName FStageEditorModule::StageEditorTabName("StageEditorTab");
 const FName FStageEditorModule::StageDataLayerOutlinerTabName("StageDataLayerOutlinerTab");
+const FName FStageEditorModule::StageTimelineTabName("StageTimelineTab");
 
 #pragma region Module Interface
 
@@ -24,6 +27,9 @@ void FStageEditorModule::StartupModule()
 	InitializeStyleSet();
 	RegisterTabSpawner();
 
+	// Initialize DataLayer membership index before the status cache that subscribes to it
+	FDataLayerMembershipIndex::Get().Initialize();
+
 	// Initialize DataLayer sync status cache
 	FDataLayerSyncStatusCache::Get().Initialize();
 
@@ -36,6 +42,7 @@ void FStageEditorModule::ShutdownModule()
 {
 	// Shutdown DataLayer sync status cache
 	FDataLayerSyncStatusCache::Get().Shutdown();
+	FDataLayerMembershipIndex::Get().Shutdown();
 
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
@@ -87,12 +94,26 @@ void FStageEditorModule::RegisterTabSpawner()
 		.SetIcon(FSlateIcon(
 			FStageEditorStyleSetRegistry::GetStyleSetName(),
 			FStageEditorStyleNames::TabIconBrushName)); // TODO: Add unique icon
+
+	// Register Stage Timeline tab (viewer for Stage.Record captures)
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(
+		StageTimelineTabName,
+		FOnSpawnTab::CreateRaw(this, &FStageEditorModule::OnSpawnStageTimelineTab))
+		.SetDisplayName(LOCTEXT("StageTimelineTabTitle", "Stage Timeline"))
+		.SetTooltipText(LOCTEXT("StageTimelineTabTooltip", "Scrub .stagerec captures written by the Stage.Record console command"))
+		.SetMenuType(ETabSpawnerMenuType::Enabled)
+		.SetGroup(WorkspaceMenu::GetMenuStructure().GetToolsCategory())
+		.SetAutoGenerateMenuEntry(true)
+		.SetIcon(FSlateIcon(
+			FStageEditorStyleSetRegistry::GetStyleSetName(),
+			FStageEditorStyleNames::TabIconBrushName));
 }
 
 void FStageEditorModule::UnregisterTabSpawner()
 {
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(StageEditorTabName);
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(StageDataLayerOutlinerTabName);
+	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(StageTimelineTabName);
 }
 
 TSharedRef<SDockTab> FStageEditorModule::OnSpawnStageEditorTab(const FSpawnTabArgs& Args)
@@ -120,6 +141,16 @@ TSharedRef<SDockTab> FStageEditorModule::OnSpawnStageDataLayerOutlinerTab(const
 		];
 }
 
+TSharedRef<SDockTab> FStageEditorModule::OnSpawnStageTimelineTab(const FSpawnTabArgs& Args)
+{
+	return SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		.Label(LOCTEXT("StageTimelineTabLabel", "Stage Timeline"))
+		[
+			SNew(SStageTimelineViewer)
+		];
+}
+
 #pragma endregion Tab Registration
 
 #pragma region Toolbar Extension
@@ -0,0 +1,175 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "DataLayer/DataLayerAction.h"
+
+class UDataLayerInstance;
+class AActor;
+class AStage;
+class UWorld;
+
+/** DataLayerInstance → 直接成员 Actor 的分桶结果 */
+using FDataLayerActorBuckets = TMap<const UDataLayerInstance*, TArray<AActor*>>;
+
+/**
+ * Actor → DataLayer 成员索引 (单例)
+ *
+ * 维护 DataLayerInstance → Actor 软路径集合的映射，避免每次状态检测都遍历整个世界。
+ *
+ * 设计原则:
+ * - 延迟构建：首次查询时对编辑器世界做一次完整扫描
+ * - 增量维护：OnLevelActorAdded/Deleted 与 Actor DataLayer 变化事件只更新相关条目
+ * - 兜底重建：关卡 Actor 列表整体变化、DataLayer 删除/重置或编辑器世界切换时标记为脏，下次查询时重建
+ *
+ * 性能提升:
+ * - DetectActLevelChanges: O(W) 世界遍历 → O(M) 成员集合查找（M = 该 DataLayer 的 Actor 数）
+ * - BucketActorsByDataLayer: 导入/预览/同步一次遍历世界完成所有 Act 的分桶
+ */
+class STAGEEDITOR_API FDataLayerMembershipIndex
+{
+public:
+	/** 获取单例实例 */
+	static FDataLayerMembershipIndex& Get();
+
+	/** 成员变化委托 - 参数为成员发生增删的 DataLayerInstance */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnMembershipChanged, const UDataLayerInstance*);
+
+	//----------------------------------------------------------------
+	// 查询 API
+	//----------------------------------------------------------------
+
+	/**
+	 * 获取 DataLayerInstance 当前包含的 Actor 软路径集合
+	 *
+	 * @param Instance 目标 DataLayerInstance
+	 * @return 成员集合；没有成员时返回 nullptr
+	 */
+	const TSet<FSoftObjectPath>* FindActors(const UDataLayerInstance* Instance);
+
+	/**
+	 * 单次遍历世界，将 Actor 按所属 DataLayerInstance 分桶
+	 *
+	 * 导入/预览/同步需要的是可直接注册的 AActor*，而非索引中的软路径，
+	 * 因此这里直接扫描一次世界，替代 "每个 Act 扫描一次世界" 的 O(W × A) 模式。
+	 *
+	 * @param World 目标世界
+	 * @param InstanceFilter 可选，只收集这些 DataLayerInstance 的桶；为空时收集全部
+	 * @param ExcludedActor 可选，跳过的 Actor（通常是 Stage 自身）
+	 * @return DataLayerInstance → Actor 列表（保持世界遍历顺序）
+	 */
+	static FDataLayerActorBuckets BucketActorsByDataLayer(
+		UWorld* World,
+		const TSet<const UDataLayerInstance*>* InstanceFilter = nullptr,
+		const AActor* ExcludedActor = nullptr);
+
+	//----------------------------------------------------------------
+	// Entity 同步规则（状态检测、单行同步、批量同步共用）
+	//----------------------------------------------------------------
+
+	/**
+	 * 收集 Stage 所有 Act DataLayer 的成员 Actor 路径并集
+	 *
+	 * @param Stage 目标 Stage
+	 * @return 属于该 Stage 任一 Act DataLayer 的 Actor 软路径
+	 */
+	TSet<FSoftObjectPath> CollectStageActMemberPaths(const AStage* Stage);
+
+	/**
+	 * 已注册 Entity 是否应注销：只有不再属于 Stage 任一 Act DataLayer 时才注销，
+	 * 因此同一 Stage 的多个 Act 不会互相把对方的成员当作 "已移除"
+	 *
+	 * @param EntityPath 已注册 Entity 的软路径
+	 * @param StageActMemberPaths CollectStageActMemberPaths 的结果
+	 */
+	static bool ShouldUnregisterEntity(const FSoftObjectPath& EntityPath, const TSet<FSoftObjectPath>& StageActMemberPaths)
+	{
+		return !StageActMemberPaths.Contains(EntityPath);
+	}
+
+	/** 成员发生增删时广播（用于精准失效状态缓存） */
+	FOnMembershipChanged& OnMembershipChanged() { return MembershipChangedEvent; }
+
+	/** 标记索引需要完整重建（下次查询时执行） */
+	void MarkDirty() { bIsDirty = true; }
+
+	//----------------------------------------------------------------
+	// 生命周期
+	//----------------------------------------------------------------
+
+	/** 初始化索引（在 Module 启动时调用） */
+	void Initialize();
+
+	/** 关闭索引（在 Module 关闭时调用） */
+	void Shutdown();
+
+private:
+	FDataLayerMembershipIndex() = default;
+	~FDataLayerMembershipIndex() = default;
+
+	// 禁止拷贝
+	FDataLayerMembershipIndex(const FDataLayerMembershipIndex&) = delete;
+	FDataLayerMembershipIndex& operator=(const FDataLayerMembershipIndex&) = delete;
+
+	//----------------------------------------------------------------
+	// 内部状态
+	//----------------------------------------------------------------
+
+	/** DataLayerInstance → 成员 Actor 软路径 */
+	TMap<TObjectKey<UDataLayerInstance>, TSet<FSoftObjectPath>> InstanceToActors;
+
+	/** Actor 软路径 → 所属 DataLayerInstance（用于删除和变化时移除旧成员关系） */
+	TMap<FSoftObjectPath, TArray<TObjectKey<UDataLayerInstance>>> ActorToInstances;
+
+	/** 索引对应的编辑器世界 */
+	TWeakObjectPtr<UWorld> IndexedWorld;
+
+	/** 是否需要完整重建 */
+	bool bIsDirty = true;
+
+	/** 是否已初始化 */
+	bool bIsInitialized = false;
+
+	FOnMembershipChanged MembershipChangedEvent;
+
+	//----------------------------------------------------------------
+	// 事件句柄
+	//----------------------------------------------------------------
+
+	FDelegateHandle ActorAddedHandle;
+	FDelegateHandle ActorDeletedHandle;
+	FDelegateHandle ActorListChangedHandle;
+	FDelegateHandle ActorDataLayersChangedHandle;
+	FDelegateHandle DataLayerChangedHandle;
+
+	//----------------------------------------------------------------
+	// 内部方法
+	//----------------------------------------------------------------
+
+	/** 确保索引与当前编辑器世界一致，必要时重建 */
+	void EnsureUpToDate();
+
+	/** 完整扫描世界重建索引 */
+	void Rebuild(UWorld* World);
+
+	/** 添加 Actor 的成员关系 */
+	void AddActor(AActor* Actor, bool bBroadcast);
+
+	/** 移除 Actor 的成员关系 */
+	void RemoveActor(const FSoftObjectPath& ActorPath, bool bBroadcast);
+
+	/** 该 Actor 是否属于已索引的世界 */
+	bool IsIndexedActor(const AActor* Actor) const;
+
+	//----------------------------------------------------------------
+	// 事件回调
+	//----------------------------------------------------------------
+
+	void OnActorAdded(AActor* Actor);
+	void OnActorDeleted(AActor* Actor);
+	void OnActorListChanged();
+	void OnActorDataLayersChanged(const TWeakObjectPtr<AActor>& ChangedActor);
+	void OnDataLayerChanged(const EDataLayerAction Action, const TWeakObjectPtr<const UDataLayerInstance>& ChangedInstance, const FName& ChangedProperty);
+};
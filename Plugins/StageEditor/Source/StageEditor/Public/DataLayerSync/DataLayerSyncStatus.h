@@ -38,6 +38,10 @@ struct STAGEEDITOR_API FDataLayerSyncStatusInfo
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SyncStatus")
 	EDataLayerSyncStatus Status = EDataLayerSyncStatus::NotImported;
 
+	/** 是否为过期值（缓存失效、后台重新计算尚未完成时返回上一次的结果） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SyncStatus")
+	bool bIsStale = false;
+
 	//----------------------------------------------------------------
 	// 子 DataLayer 变化（仅 Stage 级别）
 	//----------------------------------------------------------------
@@ -5,10 +5,12 @@
 #include "CoreMinimal.h"
 #include "DataLayerSync/DataLayerSyncStatus.h"
 #include "DataLayer/DataLayerAction.h"
+#include "Containers/Ticker.h"
 
 class UDataLayerAsset;
 class UDataLayerInstance;
 class AActor;
+class AStage;
 
 /**
  * 缓存的同步状态条目
@@ -40,7 +42,9 @@ struct FCachedSyncStatus
  * 设计原则:
  * - 读取优先：UI 读取直接返回缓存，无需计算
  * - 事件驱动：监听变化事件，精准失效
- * - 按需计算：缓存失效时在 GetCachedStatus 中立即重新计算
+ * - 后台计算：缓存失效时 GetCachedStatus 返回上一次的值（bIsStale = true），
+ *   重新计算排入队列，在游戏线程上分帧执行（每帧 RecomputeBudgetSeconds），
+ *   结果就绪后通过 OnStatusUpdated 通知 UI
  *
  * 刷新触发方式:
  * - DataLayer 变化事件（重命名、删除、层级变化）
@@ -50,7 +54,7 @@ struct FCachedSyncStatus
  *
  * 性能提升:
  * - UI 刷新: 50 × O(W) → 50 × O(1) (缓存有效时)
- * - 事件触发时重新计算，确保状态准确
+ * - 行构建和排序比较器中不再同步计算，失效后 UI 不会卡顿
  */
 class STAGEEDITOR_API FDataLayerSyncStatusCache
 {
@@ -58,6 +62,9 @@ public:
 	/** 获取单例实例 */
 	static FDataLayerSyncStatusCache& Get();
 
+	/** 状态更新委托 - 参数为本批次重新计算完成的 Asset */
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnSyncStatusUpdated, const TArray<TWeakObjectPtr<const UDataLayerAsset>>&);
+
 	//----------------------------------------------------------------
 	// 缓存读取 API - O(1)
 	//----------------------------------------------------------------
@@ -65,8 +72,11 @@ public:
 	/**
 	 * 获取缓存的状态（始终立即返回，不阻塞）
 	 *
+	 * 缓存失效或不存在时返回上一次的值（无缓存时为 NotImported），并标记 bIsStale，
+	 * 同时安排后台重新计算。
+	 *
 	 * @param Asset 目标 DataLayerAsset
-	 * @return 缓存的状态信息；如无缓存返回 NotImported
+	 * @return 缓存的状态信息
 	 */
 	FDataLayerSyncStatusInfo GetCachedStatus(const UDataLayerAsset* Asset);
 
@@ -89,6 +99,15 @@ public:
 	 */
 	void InvalidateCache(const UDataLayerAsset* Asset);
 
+	/**
+	 * 使 Stage 自身及其所有 Act 的 DataLayer 条目失效
+	 *
+	 * Act 行的 "已移除" 计数依赖该 Stage 所有 Act 的成员，因此任一 Act 变化都要失效整个 Stage
+	 *
+	 * @param Stage 目标 Stage
+	 */
+	void InvalidateStage(const AStage* Stage);
+
 	/**
 	 * 使所有缓存失效
 	 */
@@ -102,6 +121,12 @@ public:
 	 */
 	FDataLayerSyncStatusInfo ForceRefresh(const UDataLayerAsset* Asset);
 
+	/** 重新计算完成时广播（每帧最多一次，批量） */
+	FOnSyncStatusUpdated& OnStatusUpdated() { return StatusUpdatedEvent; }
+
+	/** 是否有等待重新计算的条目 */
+	bool HasPendingRecompute() const { return PendingRecompute.Num() > 0; }
+
 	//----------------------------------------------------------------
 	// 生命周期
 	//----------------------------------------------------------------
@@ -133,6 +158,20 @@ private:
 	/** 是否已初始化 */
 	bool bIsInitialized = false;
 
+	/** 等待重新计算的 Asset（FIFO） */
+	TArray<TWeakObjectPtr<const UDataLayerAsset>> PendingRecompute;
+
+	/** PendingRecompute 去重 */
+	TSet<TWeakObjectPtr<const UDataLayerAsset>> PendingRecomputeSet;
+
+	/** 分帧重新计算的 Ticker */
+	FTSTicker::FDelegateHandle RecomputeTickerHandle;
+
+	/** 每帧重新计算的时间预算（秒）；每帧至少处理一个条目 */
+	static constexpr double RecomputeBudgetSeconds = 0.002;
+
+	FOnSyncStatusUpdated StatusUpdatedEvent;
+
 	//----------------------------------------------------------------
 	// 事件句柄
 	//----------------------------------------------------------------
@@ -148,6 +187,12 @@ private:
 	/** 计算单个 Asset 的状态（内部使用） */
 	FDataLayerSyncStatusInfo ComputeStatus(const UDataLayerAsset* Asset);
 
+	/** 将 Asset 排入重新计算队列 */
+	void ScheduleRecompute(const UDataLayerAsset* Asset);
+
+	/** 分帧处理重新计算队列 */
+	bool TickRecompute(float DeltaTime);
+
 	/** 绑定事件监听 */
 	void BindEvents();
 
@@ -162,6 +207,10 @@ private:
 	void OnActorAddedToWorld(AActor* Actor);
 	void OnActorRemovedFromWorld(AActor* Actor);
 
+	/** Actor DataLayer 成员变化回调（来自 FDataLayerMembershipIndex） */
+	void OnDataLayerMembershipChanged(const UDataLayerInstance* Instance);
+	FDelegateHandle MembershipChangedHandle;
+
 	/** Stage 注册回调 - 当 Stage 通过 PostLoad 等方式注册时触发缓存失效 */
 	void OnStageRegistered(class AStage* Stage);
 
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "DataLayerSync/DataLayerSyncStatus.h"
+#include "DataLayerSync/DataLayerMembershipIndex.h"
+#include "UObject/SoftObjectPath.h"
 #include "DataLayerSynchronizer.generated.h"
 
 class UDataLayerAsset;
@@ -79,6 +81,51 @@ struct STAGEEDITOR_API FDataLayerBatchSyncResult
 	/** 总 Entity 变化 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Sync")
 	int32 TotalEntityChanges = 0;
+
+	/** 用户是否在进度对话框中取消（取消前已应用的变化保留在同一个事务中，可一次撤销） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Sync")
+	bool bWasCancelled = false;
+};
+
+/**
+ * 批量同步中单个 DataLayer 的分析结果（SyncAllOutOfSync 内部使用）
+ *
+ * 快照字段在游戏线程填充，差异字段由并行分析阶段只基于快照计算，不访问 UObject。
+ */
+struct FDataLayerBatchSyncItem
+{
+	UDataLayerAsset* Asset = nullptr;
+	const UDataLayerInstance* Instance = nullptr;
+	AStage* Stage = nullptr;
+	bool bStageLevel = false;
+	int32 ActID = INDEX_NONE;
+
+	/** Stage 级别：DetectStatus 结果 */
+	FDataLayerSyncStatusInfo StatusInfo;
+
+	/** Act 级别快照：当前成员 Actor 及其路径（一一对应） */
+	TArray<AActor*> CurrentActors;
+	TArray<FSoftObjectPath> CurrentActorPaths;
+
+	/** Act 级别差异：待注册 Actor / 待注销 EntityID */
+	TArray<AActor*> ActorsToRegister;
+	TArray<int32> EntityIDsToRemove;
+
+	bool bOutOfSync = false;
+};
+
+/**
+ * 批量同步中单个 Stage 的 EntityRegistry 快照
+ *
+ * 分析阶段只读；应用阶段作为实时状态，随注册/注销更新 RegisteredEntityPaths。
+ */
+struct FDataLayerBatchSyncStageSnapshot
+{
+	TArray<TPair<int32, FSoftObjectPath>> RegisteredEntities;
+	TSet<FSoftObjectPath> RegisteredEntityPaths;
+
+	/** FDataLayerMembershipIndex::CollectStageActMemberPaths 的结果（Entity 注销规则） */
+	TSet<FSoftObjectPath> ActMemberPaths;
 };
 
 /**
@@ -105,6 +152,12 @@ public:
 	/**
 	 * 同步所有 OutOfSync 的 DataLayer
 	 *
+	 * 分三个阶段，显示可取消的进度对话框:
+	 * 1. 快照：游戏线程上一次遍历世界，记录各 DataLayer 成员与各 Stage 的 EntityRegistry
+	 * 2. 分析：基于快照并行计算每个 Act 级 DataLayer 的差异
+	 * 3. 应用：在单个事务中应用所有差异，每个 Stage 只广播一次数据变化。
+	 *    同一 Stage 的多个 Act 共享快照，因此应用时按实时注册路径集过滤，避免重复注册或重复注销
+	 *
 	 * @param World 目标 World（可选，默认使用编辑器 World）
 	 * @return 批量同步结果
 	 */
@@ -138,14 +191,24 @@ private:
 		const FDataLayerSyncStatusInfo& StatusInfo,
 		UWorld* World);
 
+	/**
+	 * 应用批量同步分析阶段计算出的 Act 级别差异
+	 *
+	 * @param StageState 该 Stage 的实时状态（已注册路径在应用过程中更新）
+	 */
+	static FDataLayerSyncResult ApplyActLevelDiff(const FDataLayerBatchSyncItem& Item, FDataLayerBatchSyncStageSnapshot& StageState);
+
 	/**
 	 * 为新的子 DataLayer 创建 Act
+	 *
+	 * @param ActorBuckets 可选，调用方预先分桶的 Actor；为空时单独扫描世界
 	 */
 	static bool CreateActFromDataLayer(
 		AStage* Stage,
 		UDataLayerAsset* ActDataLayerAsset,
 		const FString& ActName,
-		UWorld* World);
+		UWorld* World,
+		const FDataLayerActorBuckets* ActorBuckets = nullptr);
 
 	/**
 	 * 删除对应已移除 DataLayer 的 Act
@@ -94,6 +94,9 @@ private:
 	/** Called when Actor's DataLayer membership changes */
 	void OnActorDataLayersChanged(const TWeakObjectPtr<AActor>& ChangedActor);
 
+	/** Called when background sync status computation finishes (rows repaint themselves; only re-sorts) */
+	void OnSyncStatusUpdated(const TArray<TWeakObjectPtr<const class UDataLayerAsset>>& UpdatedAssets);
+
 	//----------------------------------------------------------------
 	// Toolbar Actions
 	//----------------------------------------------------------------
@@ -146,4 +149,5 @@ private:
 	FDelegateHandle OnDataLayerChangedHandle;
 	FDelegateHandle OnActorDataLayersChangedHandle;
 	FDelegateHandle OnMapChangedHandle;
+	FDelegateHandle OnSyncStatusUpdatedHandle;
 };
@@ -4,13 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "ISceneOutlinerHierarchy.h"
+#include "Containers/Ticker.h"
+#include "SceneOutlinerStandaloneTypes.h"
 #include "UObject/WeakObjectPtrTemplates.h"
 
 class AActor;
 class FStageDataLayerMode;
 class UDataLayerInstance;
 class UWorld;
-struct FSceneOutlinerTreeItemID;
 enum class EDataLayerAction : uint8;
 
 /**
@@ -28,7 +29,8 @@ enum class EDataLayerAction : uint8;
  * Key design decisions:
  * - Only shows DataLayerInstance nodes (no Actor children)
  * - Supports parent DataLayer relationships for hierarchical display
- * - Event-driven refresh when DataLayers change
+ * - Event-driven refresh when DataLayers change, coalesced to at most one update per frame
+ * - Single-instance add/remove/rename/reparent is emitted as incremental Added/Removed/Moved events
  * - Simple filtering: show all DataLayers regardless of type
  *
  * @see ISceneOutlinerHierarchy - Base interface from SceneOutliner module
@@ -98,9 +100,20 @@ private:
 	/** Create a tree item for a DataLayer instance */
 	FSceneOutlinerTreeItemPtr CreateDataLayerTreeItem(UDataLayerInstance* InDataLayer, bool bForce = false) const;
 
-	/** Broadcast a full refresh event */
+	/** Request a full refresh (coalesced, broadcast on the next frame) */
 	void FullRefreshEvent();
 
+	/** Queue an incremental change for a single DataLayer instance (coalesced) */
+	void QueueAddedEvent(const UDataLayerInstance* DataLayer);
+	void QueueRemovedEvent(const UDataLayerInstance* DataLayer);
+	void QueueMovedEvent(const UDataLayerInstance* DataLayer);
+
+	/** Schedule FlushPendingEvents for the next frame if not already scheduled */
+	void SchedulePendingEvents();
+
+	/** Broadcast the coalesced hierarchy changes gathered this frame */
+	bool FlushPendingEvents(float DeltaTime);
+
 	//----------------------------------------------------------------
 	// Event Handlers
 	//----------------------------------------------------------------
@@ -126,4 +139,19 @@ private:
 
 	/** Whether to highlight DataLayers containing selected actors */
 	bool bHighlightSelectedDataLayers;
+
+	//----------------------------------------------------------------
+	// Coalesced Events
+	//----------------------------------------------------------------
+
+	/** A full refresh supersedes all incremental changes pending this frame */
+	bool bPendingFullRefresh = false;
+
+	/** DataLayer instances added / removed / moved (reparented or renamed) this frame */
+	TSet<TWeakObjectPtr<const UDataLayerInstance>> PendingAdded;
+	TSet<FSceneOutlinerTreeItemID> PendingRemoved;
+	TSet<TWeakObjectPtr<const UDataLayerInstance>> PendingMoved;
+
+	/** Next-frame flush of the pending events */
+	FTSTicker::FDelegateHandle FlushTickerHandle;
 };
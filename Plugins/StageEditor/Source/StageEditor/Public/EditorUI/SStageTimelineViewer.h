@@ -0,0 +1,82 @@
+#pragma once
+
+#pragma region Imports
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Debug/StageTimelineRecorder.h"
+#pragma endregion Imports
+
+class SStageTimelineGraph;
+
+/**
+ * @brief Editor viewer for .stagerec captures written by "Stage.Record Dump".
+ *
+ * Shows a frame-time graph above one lane per Stage with a tick per recorded event.
+ * Click or drag to scrub; the mouse wheel zooms around the cursor. The list below shows
+ * the events leading up to the scrub position.
+ */
+class STAGEEDITOR_API SStageTimelineViewer : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SStageTimelineViewer) {}
+	SLATE_END_ARGS()
+
+#pragma region Construction
+	/**
+	 * @brief Constructs the widget
+	 * @param InArgs Slate arguments
+	 */
+	void Construct(const FArguments& InArgs);
+#pragma endregion Construction
+
+#pragma region Core API
+	/**
+	 * @brief Loads a capture file and resets the view to its full range.
+	 * @param Filename Path to a .stagerec file
+	 * @return True if the file was read
+	 */
+	bool LoadCapture(const FString& Filename);
+#pragma endregion Core API
+
+private:
+#pragma region Callbacks
+	/** Opens a file dialog (defaulting to Saved/Profiling/StageRecordings) and loads the chosen capture. */
+	FReply OnOpenCaptureClicked();
+
+	/** Scrub position changed in the graph. */
+	void OnScrubTimeChanged(double NewTime);
+
+	/** Generates one event list row. */
+	TSharedRef<ITableRow> OnGenerateEventRow(TSharedPtr<int32> EventIndex, const TSharedRef<STableViewBase>& OwnerTable);
+#pragma endregion Callbacks
+
+#pragma region Helpers
+	/** Refills the event list with the events leading up to the scrub time. */
+	void RebuildEventList();
+
+	/** Header line: file, counts, frame at scrub. */
+	FText GetInfoText() const;
+#pragma endregion Helpers
+
+#pragma region Members
+	/** Loaded capture (shared with the graph). */
+	TSharedPtr<FStageTimelineCapture> Capture;
+
+	/** Path of the loaded capture. */
+	FString CaptureFilename;
+
+	TSharedPtr<SStageTimelineGraph> Graph;
+
+	TSharedPtr<SListView<TSharedPtr<int32>>> EventListView;
+
+	/** Indices into Capture->Events shown in the list. */
+	TArray<TSharedPtr<int32>> EventListItems;
+
+	/** Current scrub time (seconds since recording start). */
+	double ScrubTime = 0.0;
+
+	/** Maximum number of events listed before the scrub time. */
+	static constexpr int32 MaxListedEvents = 200;
+#pragma endregion Members
+};
@@ -119,7 +119,7 @@ struct FStageTreeItem : public TSharedFromThis<FStageTreeItem>
 	TWeakObjectPtr<AStage> StagePtr; // For Stage Root
 	TArray<TSharedPtr<FStageTreeItem>> Children;
 	TWeakPtr<FStageTreeItem> Parent;
-	FString ActorPath;
+	FSoftObjectPath ActorPath; // Only set for Entities whose actor is not loaded (WP), selection-sync fallback
 	int32 EntityState = 0;
 	bool bHasEntityState = false;
 
@@ -190,6 +190,12 @@ public:
 	 * @details Rebuilds the tree view items based on the current state of the Stage and its Acts/Entities.
 	 */
 	void RefreshUI();
+
+	/**
+	 * @brief Schedules RefreshUI for the next Slate tick.
+	 * @details Multiple requests within a frame (e.g. OnModelChanged bursts) collapse into one refresh.
+	 */
+	void RequestRefreshUI();
 #pragma endregion Core API
 
 #pragma region Drag & Drop Support
@@ -277,14 +283,25 @@ private:
 	/** Checks if the current level is a World Partition level. */
 	bool IsWorldPartitionLevel() const;
 
-	/** Helper to get a unique hash/string for a tree item to persist expansion state. */
-	FString GetItemHash(TSharedPtr<FStageTreeItem> Item);
+	/** Active timer callback for RequestRefreshUI. */
+	EActiveTimerReturnType HandleDeferredRefreshUI(double InCurrentTime, float InDeltaTime);
 
-	/** Saves the current expansion state of the TreeView. */
-	void SaveExpansionState(TSet<FString>& OutExpansionState);
+	/**
+	 * @brief Patches a Stage item's Acts/Entities in place (keyed by ActID / EntityID).
+	 * @return True if an existing item's displayed data changed (its row must be regenerated).
+	 */
+	bool ReconcileStageItem(const TSharedPtr<FStageTreeItem>& StageItem, AStage* Stage);
 
-	/** Restores the expansion state of the TreeView. */
-	void RestoreExpansionState(const TSet<FString>& InExpansionState);
+	/** Indexes the current children of an item by ID for reuse. */
+	static TMap<int32, TSharedPtr<FStageTreeItem>> IndexChildrenByID(const TSharedPtr<FStageTreeItem>& ParentItem);
+
+	/** Reuses the child with the given ID (or creates one) and appends it to ParentItem. */
+	static TSharedPtr<FStageTreeItem> TakeOrCreateChild(TMap<int32, TSharedPtr<FStageTreeItem>>& PreviousChildren,
+		const TSharedPtr<FStageTreeItem>& ParentItem, EStageTreeItemType Type, int32 ID);
+
+	/** Updates an item's data; returns true if anything shown by its row changed. */
+	static bool PatchTreeItem(FStageTreeItem& Item, const FString& DisplayName, int32 ID, AActor* Actor, AStage* Stage,
+		int32 EntityState = 0, bool bHasEntityState = false, const FSoftObjectPath& UnloadedActorPath = FSoftObjectPath());
 
 	/**
 	 * @brief Tracks the Stage item currently being hovered during drag operations
@@ -374,8 +391,11 @@ private:
 	/** Weak reference to the settings popup window (to prevent multiple windows) */
 	TWeakPtr<SWindow> SettingsWindow;
 
-	/** Map of actor path to the corresponding tree item for quick selection sync. */
-	TMap<FString, TWeakPtr<FStageTreeItem>> ActorPathToTreeItem;
+	/** Map of loaded actor to the corresponding tree item for quick selection sync. */
+	TMap<FObjectKey, TWeakPtr<FStageTreeItem>> ActorToTreeItem;
+
+	/** Fallback for Entities whose actor was not loaded (WP) when the tree was built. */
+	TMap<FSoftObjectPath, TWeakPtr<FStageTreeItem>> UnloadedActorPathToTreeItem;
 
 	/** Delegate handle for selection change events. */
 	FDelegateHandle ViewportSelectionDelegateHandle;
@@ -410,6 +430,9 @@ private:
 	/** Rebuilds the entire UI (used when World Partition state changes). */
 	void RebuildUI();
 
+	/** True while a deferred RefreshUI is scheduled. */
+	bool bRefreshUIPending = false;
+
 	/** Guards to prevent recursive selection updates. */
 	bool bUpdatingTreeSelectionFromViewport = false;
 	bool bUpdatingViewportSelectionFromPanel = false;
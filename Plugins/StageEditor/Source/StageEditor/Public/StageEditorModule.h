@@ -27,6 +27,9 @@ public:
 	/** Tab identifier for the Stage DataLayer Outliner panel. */
 	static const FName StageDataLayerOutlinerTabName;
 
+	/** Tab identifier for the Stage Timeline capture viewer. */
+	static const FName StageTimelineTabName;
+
 	#pragma region Module Interface
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
@@ -68,6 +71,9 @@ private:
 
 	/** Callback when Stage DataLayer Outliner tab is spawned. */
 	TSharedRef<SDockTab> OnSpawnStageDataLayerOutlinerTab(const FSpawnTabArgs& Args);
+
+	/** Callback when Stage Timeline tab is spawned. */
+	TSharedRef<SDockTab> OnSpawnStageTimelineTab(const FSpawnTabArgs& Args);
 	#pragma endregion Tab Registration
 
 	#pragma region Toolbar Extension
@@ -49,6 +49,8 @@ public class StageEditor : ModuleRules
 				"WorldPartitionEditor",
 				"EditorSubsystem",  // For UEditorSubsystem base class
 				"Projects",         // For IPluginManager (StyleSet icon loading)
+				"Json",             // For benchmark commandlet result files
+				"DesktopPlatform",  // For the Stage Timeline open-file dialog
 				// ... add private dependencies that you statically link with here ...
 			}
 			);
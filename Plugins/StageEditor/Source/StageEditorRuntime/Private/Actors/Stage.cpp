@@ -6,15 +6,40 @@
 #include "GameFramework/Pawn.h"
 #include "WorldPartition/DataLayer/DataLayerManager.h"
 #include "WorldPartition/DataLayer/DataLayerAsset.h"
+#include "WorldPartition/WorldPartitionSubsystem.h"
+#include "WorldPartition/WorldPartitionStreamingSource.h"
 #include "Subsystems/StageManagerSubsystem.h"
+#include "Debug/StageTrace.h"
+#include "Debug/StageStats.h"
+#include "Debug/StageTimelineRecorder.h"
 #include "TimerManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogStage, Log, All);
 
+/** Records a timeline event on the world's StageManagerSubsystem (no-op unless Stage.Record is running). */
+static void RecordTimelineEvent(const AStage* Stage, EStageTimelineEventType Type, int32 Param = 0, uint8 ValueA = 0, uint8 ValueB = 0)
+{
+	if (!FStageTimelineRecorder::IsAnyRecording())
+	{
+		return;
+	}
+
+	if (UWorld* World = Stage->GetWorld())
+	{
+		if (UStageManagerSubsystem* Subsystem = World->GetSubsystem<UStageManagerSubsystem>())
+		{
+			Subsystem->GetTimelineRecorder().Record(Type, Stage->GetStageID(), Param, ValueA, ValueB);
+		}
+	}
+}
+
 void AStage::PostLoad()
 {
 	Super::PostLoad();
 
+	RebuildActIndex();
+	ValidateNextEntityID();
+
 	// 只在编辑器模式下注册，不在 PIE/游戏运行时注册
 	// 避免 PIE 数据污染编辑器的注册表
 #if WITH_EDITOR
@@ -127,6 +152,11 @@ void AStage::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
+	// Acts may have been edited through the Details panel
+	RebuildActIndex();
+	MarkEffectiveEntityStatesDirty();
+	NotifyDataLayersChanged();
+
 	const FName PropertyName = PropertyChangedEvent.GetPropertyName();
 
 	// For struct properties (like FVector), we need to check MemberProperty
@@ -169,6 +199,17 @@ void AStage::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 	}
 }
 
+void AStage::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	// Undo/redo restores Acts and EntityRegistry wholesale
+	RebuildActIndex();
+	ValidateNextEntityID();
+	MarkEffectiveEntityStatesDirty();
+	NotifyDataLayersChanged();
+}
+
 void AStage::BeginDestroy()
 {
 	// Note: Subsystem unregistration is handled by StageEditorController::OnLevelActorDeleted
@@ -209,6 +250,10 @@ void AStage::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Count before any initial transition below so the per-state gauges stay balanced
+	FStageStats::OnStageBeginPlay(CurrentStageState);
+	bCountedInStageStats = true;
+
 	// Register with StageManagerSubsystem
 	// This ensures Stage is registered even in WorldPartition where it may load after Subsystem init
 	if (UWorld* World = GetWorld())
@@ -250,12 +295,29 @@ void AStage::BeginPlay()
 	// when Stage transitions to Active state (via TriggerZone or InitialStageState)
 }
 
+void AStage::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Stop waiting on the DataLayer before the world tears down: the looping poll timer and the
+	// DataLayerManager binding from BeginStageDataLayerTransition must not outlive this Stage
+	EndStageDataLayerTransition();
+
+	if (bCountedInStageStats)
+	{
+		FStageStats::OnStageEndPlay(CurrentStageState);
+		bCountedInStageStats = false;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 //----------------------------------------------------------------
 // Stage State Machine Implementation
 //----------------------------------------------------------------
 
 void AStage::InternalGotoState(EStageRuntimeState NewState)
 {
+	TRACE_STAGE_SCOPE(Stage_InternalGotoState);
+
 	// Skip if already in target state
 	if (CurrentStageState == NewState)
 	{
@@ -274,12 +336,29 @@ void AStage::InternalGotoState(EStageRuntimeState NewState)
 	UE_LOG(LogStage, Log, TEXT("Stage [%s]: State transition %d -> %d"),
 		*GetName(), (int32)CurrentStageState, (int32)NewState);
 
+	ExecuteStateTransition(NewState);
+}
+
+void AStage::ExecuteStateTransition(EStageRuntimeState NewState)
+{
+	TRACE_STAGE_STATE_CHANGE(SUID.StageID, CurrentStageState, NewState);
+	RecordTimelineEvent(this, EStageTimelineEventType::StateChange, 0, (uint8)CurrentStageState, (uint8)NewState);
+	STAGE_STAT_SCOPE_STATE_TRANSITION();
+
 	// Exit current state
 	OnExitState(CurrentStageState);
 
 	// Update state
 	EStageRuntimeState OldState = CurrentStageState;
 	CurrentStageState = NewState;
+	if (bCountedInStageStats)
+	{
+		FStageStats::OnStateTransition(OldState, NewState);
+	}
+
+	// Broadcast before entering, so nested transitions (e.g. Loaded -> Active) arrive in order
+	++DebugRevision;
+	OnStageStateChanged.Broadcast(NewState, OldState);
 
 	// Enter new state
 	OnEnterState(NewState);
@@ -291,21 +370,27 @@ void AStage::OnEnterState(EStageRuntimeState State)
 	{
 	case EStageRuntimeState::Unloaded:
 		UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Entered Unloaded state"), *GetName());
+		// An actor re-entered the LoadZone while we were still unloading
+		if (bPreloadWhenUnloaded)
+		{
+			bPreloadWhenUnloaded = false;
+			if (OverlappingLoadZoneActors.Num() > 0)
+			{
+				InternalGotoState(EStageRuntimeState::Preloading);
+			}
+		}
 		break;
 
 	case EStageRuntimeState::Preloading:
 		UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Entered Preloading state - requesting DataLayer load"), *GetName());
-		// Request Stage DataLayer to load
-		if (StageDataLayerAsset)
+		// Wait for a load slot from the streaming scheduler (starts immediately if unavailable/disabled)
+		if (UStageManagerSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UStageManagerSubsystem>() : nullptr)
 		{
-			SetStageDataLayerState(EDataLayerRuntimeState::Loaded);
-			// For now, assume immediate completion. TODO: Add async callback support
-			OnStageDataLayerLoaded();
+			Subsystem->RequestStageLoad(this, LastStreamingInstigator.Get());
 		}
 		else
 		{
-			// No DataLayer, skip to Loaded
-			OnStageDataLayerLoaded();
+			StartScheduledStageLoad();
 		}
 		break;
 
@@ -313,10 +398,11 @@ void AStage::OnEnterState(EStageRuntimeState State)
 		UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Entered Loaded state - preload buffer"), *GetName());
 		// Apply Loaded state to Acts that follow Stage state
 		ApplyFollowingActStates(EDataLayerRuntimeState::Loaded);
-		// Check if we should immediately activate (player already in ActivateZone)
-		if (OverlappingActivateZoneActors.Num() > 0)
+		// Check if we should immediately activate (player already in ActivateZone, or GotoState(Active) pending)
+		if (OverlappingActivateZoneActors.Num() > 0 || bActivateWhenLoaded)
 		{
-			InternalGotoState(EStageRuntimeState::Active);
+			bActivateWhenLoaded = false;
+			RequestStageActivation(LastStreamingInstigator.Get());
 		}
 		break;
 
@@ -327,10 +413,14 @@ void AStage::OnEnterState(EStageRuntimeState State)
 		{
 			SetStageDataLayerState(EDataLayerRuntimeState::Activated);
 		}
-		// Apply Activated state to Acts that follow Stage state
-		ApplyFollowingActStates(EDataLayerRuntimeState::Activated);
-		// Apply InitialDataLayerState for Acts that don't follow Stage state
-		ApplyInitialActDataLayerStates();
+		{
+			// Both passes may activate several Acts; apply Entity states once at the end
+			FScopedActBatch Batch(this);
+			// Apply Activated state to Acts that follow Stage state
+			ApplyFollowingActStates(EDataLayerRuntimeState::Activated);
+			// Apply InitialDataLayerState for Acts that don't follow Stage state
+			ApplyInitialActDataLayerStates();
+		}
 		break;
 
 	case EStageRuntimeState::Unloading:
@@ -339,12 +429,14 @@ void AStage::OnEnterState(EStageRuntimeState State)
 		// This is necessary because child DataLayers "remember" their state when parent unloads,
 		// and will restore to that state when parent reloads.
 		UnloadAllActDataLayers();
-		// Request Stage DataLayer to unload
-		if (StageDataLayerAsset)
+		// A pending GotoState(Active) or prediction is cancelled by unloading
+		bActivateWhenLoaded = false;
+		bPredictivePreload = false;
+		CancelPendingUnload(false);
+		// Request Stage DataLayer to unload and wait for streaming to complete
+		if (StageDataLayerAsset && SetStageDataLayerState(EDataLayerRuntimeState::Unloaded))
 		{
-			SetStageDataLayerState(EDataLayerRuntimeState::Unloaded);
-			// For now, assume immediate completion. TODO: Add async callback support
-			OnStageDataLayerUnloaded();
+			BeginStageDataLayerTransition(EDataLayerRuntimeState::Unloaded);
 		}
 		else
 		{
@@ -356,8 +448,205 @@ void AStage::OnEnterState(EStageRuntimeState State)
 
 void AStage::OnExitState(EStageRuntimeState State)
 {
-	// Currently no cleanup needed on exit
-	// Reserved for future use
+	// Leaving Preloading/Unloading (completed or interrupted) stops waiting on the DataLayer
+	if (State == EStageRuntimeState::Preloading || State == EStageRuntimeState::Unloading)
+	{
+		EndStageDataLayerTransition();
+	}
+
+	// Give back the scheduler load slot / drop a queued activation
+	if (State == EStageRuntimeState::Preloading || State == EStageRuntimeState::Loaded)
+	{
+		if (UStageManagerSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UStageManagerSubsystem>() : nullptr)
+		{
+			if (State == EStageRuntimeState::Preloading)
+			{
+				Subsystem->ReleaseStageLoad(this);
+			}
+			else
+			{
+				Subsystem->CancelStageActivation(this);
+			}
+		}
+	}
+}
+
+void AStage::StartScheduledStageLoad()
+{
+	if (CurrentStageState != EStageRuntimeState::Preloading)
+	{
+		return;
+	}
+
+	// Request Stage DataLayer to load and wait for streaming to complete
+	if (StageDataLayerAsset && SetStageDataLayerState(EDataLayerRuntimeState::Loaded))
+	{
+		BeginStageDataLayerTransition(EDataLayerRuntimeState::Loaded);
+	}
+	else
+	{
+		// No DataLayer, skip to Loaded
+		OnStageDataLayerLoaded();
+	}
+}
+
+void AStage::StartScheduledStageActivation()
+{
+	if (CurrentStageState == EStageRuntimeState::Loaded)
+	{
+		InternalGotoState(EStageRuntimeState::Active);
+	}
+}
+
+void AStage::BeginPendingUnload(AActor* DepartedActor)
+{
+	UWorld* World = GetWorld();
+	if (!World || (UnloadDelay <= 0.0f && UnloadExtentPadding <= 0.0f))
+	{
+		InternalGotoState(EStageRuntimeState::Unloading);
+		return;
+	}
+
+	if (DepartedActor)
+	{
+		PendingUnloadActors.AddUnique(DepartedActor);
+	}
+
+	if (IsUnloadPending())
+	{
+		return;
+	}
+
+	PendingUnloadStartTime = World->GetTimeSeconds();
+	World->GetTimerManager().SetTimer(PendingUnloadTimerHandle, this, &AStage::CheckPendingUnload, 0.1f, true);
+
+	UE_LOG(LogStage, Log, TEXT("Stage [%s]: Unload pending (delay %.1fs, padding %.0f)"),
+		*GetName(), UnloadDelay, UnloadExtentPadding);
+}
+
+void AStage::CancelPendingUnload(bool bAvoided)
+{
+	if (!IsUnloadPending())
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PendingUnloadTimerHandle);
+	}
+	PendingUnloadTimerHandle.Invalidate();
+	PendingUnloadActors.Reset();
+
+	if (bAvoided)
+	{
+		AvoidedUnloadCount++;
+		if (UStageManagerSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UStageManagerSubsystem>() : nullptr)
+		{
+			Subsystem->RecordAvoidedUnload();
+		}
+		UE_LOG(LogStage, Log, TEXT("Stage [%s]: Pending unload cancelled by re-entry (avoided: %d)"),
+			*GetName(), AvoidedUnloadCount);
+	}
+}
+
+void AStage::CheckPendingUnload()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Someone is back inside (safety net - re-entry normally cancels directly)
+	if (OverlappingLoadZoneActors.Num() > 0)
+	{
+		CancelPendingUnload(true);
+		return;
+	}
+
+	if (World->GetTimeSeconds() - PendingUnloadStartTime < UnloadDelay)
+	{
+		return;
+	}
+
+	// Departed actors must also clear the padded (unload) extent
+	if (UnloadExtentPadding > 0.0f)
+	{
+		for (const TWeakObjectPtr<AActor>& ActorPtr : PendingUnloadActors)
+		{
+			const AActor* Actor = ActorPtr.Get();
+			if (!Actor)
+			{
+				continue;
+			}
+
+			for (const UStageTriggerZoneComponent* Zone : RegisteredLoadZones)
+			{
+				if (Zone && Zone->IsPointInZone(Actor->GetActorLocation(), UnloadExtentPadding))
+				{
+					return;
+				}
+			}
+		}
+	}
+
+	CancelPendingUnload(false);
+
+	if (CurrentStageState == EStageRuntimeState::Preloading ||
+		CurrentStageState == EStageRuntimeState::Loaded ||
+		CurrentStageState == EStageRuntimeState::Active)
+	{
+		InternalGotoState(EStageRuntimeState::Unloading);
+	}
+}
+
+bool AStage::RequestPredictivePreload(AActor* Source)
+{
+	if (CurrentStageState != EStageRuntimeState::Unloaded || bIsStageStateLocked)
+	{
+		return false;
+	}
+
+	UE_LOG(LogStage, Log, TEXT("Stage [%s]: Predictive preload triggered by '%s'"),
+		*GetName(), Source ? *Source->GetName() : TEXT("None"));
+
+	bPredictivePreload = true;
+	LastStreamingInstigator = Source;
+	InternalGotoState(EStageRuntimeState::Preloading);
+	return true;
+}
+
+void AStage::ExpirePredictivePreload()
+{
+	if (!bPredictivePreload)
+	{
+		return;
+	}
+
+	bPredictivePreload = false;
+
+	// Nobody arrived - give the DataLayer back
+	if (OverlappingLoadZoneActors.Num() == 0 &&
+		(CurrentStageState == EStageRuntimeState::Preloading ||
+		 CurrentStageState == EStageRuntimeState::Loaded ||
+		 CurrentStageState == EStageRuntimeState::Active))
+	{
+		UE_LOG(LogStage, Log, TEXT("Stage [%s]: Predictive preload expired - unloading"), *GetName());
+		InternalGotoState(EStageRuntimeState::Unloading);
+	}
+}
+
+void AStage::RequestStageActivation(AActor* Instigator)
+{
+	if (UStageManagerSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UStageManagerSubsystem>() : nullptr)
+	{
+		Subsystem->RequestStageActivation(this, Instigator);
+	}
+	else
+	{
+		StartScheduledStageActivation();
+	}
 }
 
 void AStage::OnStageDataLayerLoaded()
@@ -376,6 +665,147 @@ void AStage::OnStageDataLayerUnloaded()
 	}
 }
 
+void AStage::BeginStageDataLayerTransition(EDataLayerRuntimeState TargetState)
+{
+	UWorld* World = GetWorld();
+	UDataLayerManager* DataLayerManager = UDataLayerManager::GetDataLayerManager(this);
+	if (!World || !DataLayerManager)
+	{
+		// Nothing to wait on - complete immediately
+		if (TargetState == EDataLayerRuntimeState::Unloaded)
+		{
+			OnStageDataLayerUnloaded();
+		}
+		else
+		{
+			OnStageDataLayerLoaded();
+		}
+		return;
+	}
+
+	PendingDataLayerTargetState = TargetState;
+	DataLayerTransitionStartTime = World->GetRealTimeSeconds();
+
+	// Runtime state changes may be applied late (e.g. replicated to clients); streaming completion
+	// is not broadcast at all, so poll at a low rate in addition to listening for notifications
+	DataLayerManager->OnDataLayerInstanceRuntimeStateChanged.AddUniqueDynamic(this, &AStage::HandleDataLayerRuntimeStateChanged);
+	BoundDataLayerManager = DataLayerManager;
+	if (!DataLayerTransitionTimerHandle.IsValid())
+	{
+		FStageStats::OnDataLayerTransitionBegin();
+	}
+	RecordTimelineEvent(this, EStageTimelineEventType::DataLayerTransitionBegin, 0, (uint8)TargetState);
+	World->GetTimerManager().SetTimer(DataLayerTransitionTimerHandle, this, &AStage::PollStageDataLayerTransition, 0.1f, true);
+
+	// Cells may already be in the target state (e.g. another system loaded them)
+	PollStageDataLayerTransition();
+}
+
+void AStage::EndStageDataLayerTransition()
+{
+	if (DataLayerTransitionTimerHandle.IsValid())
+	{
+		FStageStats::OnDataLayerTransitionEnd();
+		RecordTimelineEvent(this, EStageTimelineEventType::DataLayerTransitionEnd);
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DataLayerTransitionTimerHandle);
+	}
+
+	if (UDataLayerManager* DataLayerManager = BoundDataLayerManager.Get())
+	{
+		DataLayerManager->OnDataLayerInstanceRuntimeStateChanged.RemoveDynamic(this, &AStage::HandleDataLayerRuntimeStateChanged);
+	}
+	BoundDataLayerManager.Reset();
+}
+
+void AStage::PollStageDataLayerTransition()
+{
+	// Guard against stale timer/delegate calls after the state already moved on
+	const bool bWaitingForLoad = CurrentStageState == EStageRuntimeState::Preloading;
+	const bool bWaitingForUnload = CurrentStageState == EStageRuntimeState::Unloading;
+	if (!bWaitingForLoad && !bWaitingForUnload)
+	{
+		EndStageDataLayerTransition();
+		return;
+	}
+
+	if (!IsStageDataLayerTransitionComplete(PendingDataLayerTargetState))
+	{
+		const UWorld* World = GetWorld();
+		const double Elapsed = World ? World->GetRealTimeSeconds() - DataLayerTransitionStartTime : 0.0;
+		if (DataLayerTransitionTimeout <= 0.0f || Elapsed < DataLayerTransitionTimeout)
+		{
+			return;
+		}
+
+		UE_LOG(LogStage, Warning, TEXT("Stage [%s]: DataLayer transition to %d timed out after %.2fs - continuing"),
+			*GetName(), (int32)PendingDataLayerTargetState, Elapsed);
+	}
+
+	EndStageDataLayerTransition();
+
+	if (bWaitingForUnload)
+	{
+		OnStageDataLayerUnloaded();
+	}
+	else
+	{
+		OnStageDataLayerLoaded();
+	}
+}
+
+bool AStage::IsStageDataLayerTransitionComplete(EDataLayerRuntimeState TargetState) const
+{
+	UWorld* World = GetWorld();
+	UDataLayerManager* DataLayerManager = UDataLayerManager::GetDataLayerManager(this);
+	if (!World || !DataLayerManager || !StageDataLayerAsset)
+	{
+		return true;
+	}
+
+	const UDataLayerInstance* Instance = DataLayerManager->GetDataLayerInstanceFromAsset(StageDataLayerAsset);
+	if (!Instance)
+	{
+		return true;
+	}
+
+	// The requested runtime state must have been applied first
+	if (DataLayerManager->GetDataLayerInstanceRuntimeState(Instance) != TargetState)
+	{
+		return false;
+	}
+
+	// Then every cell of this DataLayer must have finished streaming
+	const UWorldPartitionSubsystem* WorldPartitionSubsystem = World->GetSubsystem<UWorldPartitionSubsystem>();
+	if (!WorldPartitionSubsystem)
+	{
+		return true;
+	}
+
+	FWorldPartitionStreamingQuerySource QuerySource;
+	QuerySource.bSpatialQuery = false;
+	QuerySource.bDataLayersOnly = true;
+	QuerySource.DataLayers.Add(Instance->GetDataLayerFName());
+
+	const EWorldPartitionRuntimeCellState CellState =
+		TargetState == EDataLayerRuntimeState::Activated ? EWorldPartitionRuntimeCellState::Activated :
+		TargetState == EDataLayerRuntimeState::Loaded ? EWorldPartitionRuntimeCellState::Loaded :
+		EWorldPartitionRuntimeCellState::Unloaded;
+
+	return WorldPartitionSubsystem->IsStreamingCompleted(CellState, { QuerySource }, /*bExactState=*/true);
+}
+
+void AStage::HandleDataLayerRuntimeStateChanged(const UDataLayerInstance* DataLayer, EDataLayerRuntimeState State)
+{
+	if (DataLayer && StageDataLayerAsset && DataLayer->GetAsset() == StageDataLayerAsset)
+	{
+		PollStageDataLayerTransition();
+	}
+}
+
 void AStage::ApplyFollowingActStates(EDataLayerRuntimeState TargetState)
 {
 	UE_LOG(LogStage, Log, TEXT("Stage [%s]: Applying FollowStageState for Acts (TargetState=%d)"), *GetName(), (int32)TargetState);
@@ -526,6 +956,7 @@ void AStage::ForceStageStateOverride(EStageRuntimeState NewState, bool bLockStat
 	{
 		LockedStageState = NewState;
 		bIsStageStateLocked = true;
+		++DebugRevision;
 	}
 
 	// Force the state transition (bypasses normal lock check because LockedStageState == NewState)
@@ -537,14 +968,7 @@ void AStage::ForceStageStateOverride(EStageRuntimeState NewState, bool bLockStat
 
 		LockedStageState = NewState;
 
-		// Exit current state
-		OnExitState(CurrentStageState);
-
-		// Update state
-		CurrentStageState = NewState;
-
-		// Enter new state
-		OnEnterState(NewState);
+		ExecuteStateTransition(NewState);
 
 		// Restore lock state if we weren't supposed to lock
 		if (!bLockState)
@@ -567,6 +991,7 @@ void AStage::ReleaseStageStateOverride()
 
 	bIsStageStateLocked = false;
 	LockedStageState = EStageRuntimeState::Unloaded;
+	++DebugRevision;
 
 	// Re-evaluate state based on current TriggerZone overlaps
 	// This allows the Stage to transition to the correct state based on reality
@@ -584,7 +1009,7 @@ void AStage::ReleaseStageStateOverride()
 		// Someone in ActivateZone -> should be Active
 		if (CurrentStageState == EStageRuntimeState::Loaded)
 		{
-			InternalGotoState(EStageRuntimeState::Active);
+			RequestStageActivation(nullptr);
 		}
 		else if (CurrentStageState == EStageRuntimeState::Unloaded)
 		{
@@ -610,6 +1035,7 @@ void AStage::LockAct(int32 ActID)
 	}
 
 	LockedActIDs.Add(ActID);
+	++DebugRevision;
 	UE_LOG(LogStage, Log, TEXT("Stage [%s]: Locked Act %d"), *GetName(), ActID);
 }
 
@@ -617,6 +1043,7 @@ void AStage::UnlockAct(int32 ActID)
 {
 	if (LockedActIDs.Remove(ActID) > 0)
 	{
+		++DebugRevision;
 		UE_LOG(LogStage, Log, TEXT("Stage [%s]: Unlocked Act %d"), *GetName(), ActID);
 	}
 }
@@ -751,23 +1178,48 @@ void AStage::CheckInitialOverlaps()
 
 void AStage::HandleZoneBeginOverlap(UStageTriggerZoneComponent* Zone, AActor* OtherActor)
 {
+	TRACE_STAGE_SCOPE(Stage_HandleZoneBeginOverlap);
+
 	if (!Zone || !OtherActor) return;
 
+	STAGE_STAT_EVENT(OverlapEvents, 1);
+
 	if (Zone->ZoneType == EStageTriggerZoneType::LoadZone)
 	{
 		// Add to LoadZone tracking set
 		OverlappingLoadZoneActors.Add(OtherActor);
+		LastStreamingInstigator = OtherActor;
+
+		// A real entry confirms any pending prediction; the zone now holds the Stage loaded
+		bPredictivePreload = false;
+
+		// Re-entry during the unload delay: keep the Stage loaded
+		if (IsUnloadPending())
+		{
+			CancelPendingUnload(true);
+		}
 
 		UE_LOG(LogStage, Log, TEXT("Stage [%s]: Actor '%s' entered LoadZone (count: %d)"),
 			*GetName(), *OtherActor->GetName(), OverlappingLoadZoneActors.Num());
+		TRACE_STAGE_ZONE_OVERLAP(SUID.StageID, Zone->ZoneType, true, OverlappingLoadZoneActors.Num());
+		RecordTimelineEvent(this, EStageTimelineEventType::ZoneEnter, OverlappingLoadZoneActors.Num(), (uint8)Zone->ZoneType);
 
 		// First actor entering LoadZone triggers loading
 		if (OverlappingLoadZoneActors.Num() == 1)
 		{
 			if (CurrentStageState == EStageRuntimeState::Unloaded)
 			{
+				if (UStageManagerSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UStageManagerSubsystem>() : nullptr)
+				{
+					Subsystem->RecordStageLoadTrigger(false);
+				}
 				InternalGotoState(EStageRuntimeState::Preloading);
 			}
+			else if (CurrentStageState == EStageRuntimeState::Unloading)
+			{
+				// Reload once the in-flight unload has completed
+				bPreloadWhenUnloaded = true;
+			}
 		}
 	}
 	else // ActivateZone
@@ -777,13 +1229,15 @@ void AStage::HandleZoneBeginOverlap(UStageTriggerZoneComponent* Zone, AActor* Ot
 
 		UE_LOG(LogStage, Log, TEXT("Stage [%s]: Actor '%s' entered ActivateZone (count: %d)"),
 			*GetName(), *OtherActor->GetName(), OverlappingActivateZoneActors.Num());
+		TRACE_STAGE_ZONE_OVERLAP(SUID.StageID, Zone->ZoneType, true, OverlappingActivateZoneActors.Num());
+		RecordTimelineEvent(this, EStageTimelineEventType::ZoneEnter, OverlappingActivateZoneActors.Num(), (uint8)Zone->ZoneType);
 
 		// First actor entering ActivateZone triggers activation
 		if (OverlappingActivateZoneActors.Num() == 1)
 		{
 			if (CurrentStageState == EStageRuntimeState::Loaded)
 			{
-				InternalGotoState(EStageRuntimeState::Active);
+				RequestStageActivation(OtherActor);
 			}
 		}
 	}
@@ -791,8 +1245,12 @@ void AStage::HandleZoneBeginOverlap(UStageTriggerZoneComponent* Zone, AActor* Ot
 
 void AStage::HandleZoneEndOverlap(UStageTriggerZoneComponent* Zone, AActor* OtherActor)
 {
+	TRACE_STAGE_SCOPE(Stage_HandleZoneEndOverlap);
+
 	if (!Zone || !OtherActor) return;
 
+	STAGE_STAT_EVENT(OverlapEvents, 1);
+
 	if (Zone->ZoneType == EStageTriggerZoneType::LoadZone)
 	{
 		// Remove from LoadZone tracking set
@@ -802,14 +1260,17 @@ void AStage::HandleZoneEndOverlap(UStageTriggerZoneComponent* Zone, AActor* Othe
 
 		UE_LOG(LogStage, Log, TEXT("Stage [%s]: Actor '%s' left LoadZone (count: %d)"),
 			*GetName(), *OtherActor->GetName(), OverlappingLoadZoneActors.Num());
+		TRACE_STAGE_ZONE_OVERLAP(SUID.StageID, Zone->ZoneType, false, OverlappingLoadZoneActors.Num());
+		RecordTimelineEvent(this, EStageTimelineEventType::ZoneExit, OverlappingLoadZoneActors.Num(), (uint8)Zone->ZoneType);
 
-		// Last actor leaving LoadZone triggers unloading
+		// Last actor leaving LoadZone triggers (debounced) unloading (also cancels an in-flight Preloading)
 		if (OverlappingLoadZoneActors.Num() == 0)
 		{
-			if (CurrentStageState == EStageRuntimeState::Loaded ||
+			if (CurrentStageState == EStageRuntimeState::Preloading ||
+			    CurrentStageState == EStageRuntimeState::Loaded ||
 			    CurrentStageState == EStageRuntimeState::Active)
 			{
-				InternalGotoState(EStageRuntimeState::Unloading);
+				BeginPendingUnload(OtherActor);
 			}
 		}
 	}
@@ -820,6 +1281,8 @@ void AStage::HandleZoneEndOverlap(UStageTriggerZoneComponent* Zone, AActor* Othe
 
 		UE_LOG(LogStage, Log, TEXT("Stage [%s]: Actor '%s' left ActivateZone (count: %d)"),
 			*GetName(), *OtherActor->GetName(), OverlappingActivateZoneActors.Num());
+		TRACE_STAGE_ZONE_OVERLAP(SUID.StageID, Zone->ZoneType, false, OverlappingActivateZoneActors.Num());
+		RecordTimelineEvent(this, EStageTimelineEventType::ZoneExit, OverlappingActivateZoneActors.Num(), (uint8)Zone->ZoneType);
 
 		// Design decision: Stay Active even when leaving ActivateZone (until leaving LoadZone)
 		// This prevents flickering when player is on the ActivateZone boundary
@@ -833,19 +1296,20 @@ void AStage::HandleZoneEndOverlap(UStageTriggerZoneComponent* Zone, AActor* Othe
 
 void AStage::ActivateAct(int32 ActID)
 {
-	// 1. Verify Act exists
-	if (!DoesActExist(ActID))
+	TRACE_STAGE_SCOPE(Stage_ActivateAct);
+
+	// 1. Verify Act exists (and keep it for logging and DataLayer access)
+	const FAct* TargetAct = FindActByID(ActID);
+	if (!TargetAct)
 	{
 		UE_LOG(LogStage, Warning, TEXT("Stage [%s]: Failed to activate Act %d. Act not found."), *GetName(), ActID);
 		return;
 	}
 
-	// Find the Act for logging and DataLayer access
-	const FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
-
 	UE_LOG(LogStage, Log, TEXT("Stage [%s]: Activating Act '%s' (ID:%d)"), *GetName(), *TargetAct->DisplayName, ActID);
+	TRACE_STAGE_ACT_ACTIVATED(SUID.StageID, ActID, TargetAct->EntityStateOverrides.Num());
+	STAGE_STAT_EVENT(ActActivations, 1);
+	RecordTimelineEvent(this, EStageTimelineEventType::ActActivated, ActID);
 
 	// 2. If already active, remove first (will be added to end for highest priority)
 	ActiveActIDs.Remove(ActID);
@@ -856,6 +1320,15 @@ void AStage::ActivateAct(int32 ActID)
 	// 4. Update RecentActivatedActID
 	RecentActivatedActID = ActID;
 
+	// Now the highest priority Act: it controls every Entity it overrides
+	if (!bEffectiveEntityStatesDirty)
+	{
+		for (const auto& Pair : TargetAct->EntityStateOverrides)
+		{
+			EffectiveEntityStates.Add(Pair.Key, FStageEffectiveEntityState(Pair.Value, ActID));
+		}
+	}
+
 	// 5. Activate DataLayer (Activated state, not just Loaded)
 	if (TargetAct->AssociatedDataLayer)
 	{
@@ -869,6 +1342,7 @@ void AStage::ActivateAct(int32 ActID)
 	CurrentDataLayer = TargetAct->AssociatedDataLayer;
 
 	// 8. Broadcast events
+	++DebugRevision;
 	OnActActivated.Broadcast(ActID);
 	OnActiveActsChanged.Broadcast();
 }
@@ -890,9 +1364,7 @@ void AStage::DeactivateAct(int32 ActID)
 	}
 
 	// Find Act for logging
-	const FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	const FAct* TargetAct = FindActByID(ActID);
 
 	FString ActName = TargetAct ? TargetAct->DisplayName : FString::Printf(TEXT("Act_%d"), ActID);
 	UE_LOG(LogStage, Log, TEXT("Stage [%s]: Deactivating Act '%s' (ID:%d)"), *GetName(), *ActName, ActID);
@@ -900,6 +1372,23 @@ void AStage::DeactivateAct(int32 ActID)
 	// 3. Remove from active list
 	ActiveActIDs.Remove(ActID);
 
+	// Re-resolve only the Entities this Act was controlling
+	if (TargetAct && !bEffectiveEntityStatesDirty)
+	{
+		for (const auto& Pair : TargetAct->EntityStateOverrides)
+		{
+			const FStageEffectiveEntityState* Current = EffectiveEntityStates.Find(Pair.Key);
+			if (Current && Current->ControllingActID == ActID)
+			{
+				ResolveEffectiveEntityState(Pair.Key);
+			}
+		}
+	}
+	else
+	{
+		bEffectiveEntityStatesDirty = true;
+	}
+
 	// 3. Unload DataLayer
 	SetActDataLayerState(ActID, EDataLayerRuntimeState::Unloaded);
 
@@ -909,9 +1398,7 @@ void AStage::DeactivateAct(int32 ActID)
 	if (ActiveActIDs.Num() > 0)
 	{
 		int32 HighestPriorityActID = ActiveActIDs.Last();
-		const FAct* HighestAct = Acts.FindByPredicate([HighestPriorityActID](const FAct& Act) {
-			return Act.SUID.ActID == HighestPriorityActID;
-		});
+		const FAct* HighestAct = FindActByID(HighestPriorityActID);
 		CurrentDataLayer = HighestAct ? HighestAct->AssociatedDataLayer : nullptr;
 	}
 	else
@@ -920,18 +1407,73 @@ void AStage::DeactivateAct(int32 ActID)
 	}
 
 	// 6. Broadcast events
+	++DebugRevision;
+	RecordTimelineEvent(this, EStageTimelineEventType::ActDeactivated, ActID);
 	OnActDeactivated.Broadcast(ActID);
 	OnActiveActsChanged.Broadcast();
 }
 
 void AStage::ActivateActs(const TArray<int32>& ActIDs)
 {
+	FScopedActBatch Batch(this);
+
 	for (int32 ActID : ActIDs)
 	{
 		ActivateAct(ActID);
 	}
 }
 
+//----------------------------------------------------------------
+// Act Batch API Implementation
+//----------------------------------------------------------------
+
+void AStage::BeginActBatch()
+{
+	++ActBatchDepth;
+}
+
+void AStage::EndActBatch()
+{
+	if (ActBatchDepth <= 0)
+	{
+		UE_LOG(LogStage, Warning, TEXT("Stage [%s]: EndActBatch called without matching BeginActBatch"), *GetName());
+		return;
+	}
+
+	if (--ActBatchDepth == 0)
+	{
+		FlushActBatch();
+	}
+}
+
+void AStage::FlushActBatch()
+{
+	if (PendingBatchEntityStates.Num() == 0)
+	{
+		return;
+	}
+
+	// Move out first: SetEntityStateByID may trigger Blueprint code that opens a new batch
+	TMap<int32, int32> EntityStates = MoveTemp(PendingBatchEntityStates);
+	PendingBatchEntityStates.Reset();
+
+	int32 AppliedCount = 0;
+	for (const auto& Pair : EntityStates)
+	{
+		const UStageEntityComponent* EntityComp = GetEntityComponentByID(Pair.Key);
+		if (EntityComp && EntityComp->EntityState == Pair.Value)
+		{
+			continue;
+		}
+
+		SetEntityStateByID(Pair.Key, Pair.Value);
+		++AppliedCount;
+	}
+
+	UE_LOG(LogStage, Log, TEXT("Stage [%s]: Act batch applied %d of %d Entity states"),
+		*GetName(), AppliedCount, EntityStates.Num());
+}
+
 void AStage::DeactivateAllActs()
 {
 	// Copy the array since we'll be modifying it
@@ -943,6 +1485,12 @@ void AStage::DeactivateAllActs()
 		DeactivateAct(ActID);
 	}
 
+	if (ActiveActIDs.Num() == 0)
+	{
+		EffectiveEntityStates.Reset();
+		bEffectiveEntityStatesDirty = false;
+	}
+
 	// Log if any Acts remained active due to locks
 	if (ActiveActIDs.Num() > 0)
 	{
@@ -971,47 +1519,123 @@ int32 AStage::GetHighestPriorityActID() const
 
 int32 AStage::GetEffectiveEntityState(int32 EntityID) const
 {
-	// Iterate from highest priority (end) to lowest (beginning)
-	for (int32 i = ActiveActIDs.Num() - 1; i >= 0; --i)
+	if (const FStageEffectiveEntityState* Effective = GetEffectiveEntityStates().Find(EntityID))
 	{
-		int32 ActID = ActiveActIDs[i];
-		const FAct* Act = Acts.FindByPredicate([ActID](const FAct& A) {
-			return A.SUID.ActID == ActID;
-		});
+		return Effective->State;
+	}
+
+	// Fallback: return current actual Entity state
+	return GetEntityStateByID(EntityID);
+}
 
-		if (Act)
+int32 AStage::GetControllingActForEntity(int32 EntityID) const
+{
+	if (const FStageEffectiveEntityState* Effective = GetEffectiveEntityStates().Find(EntityID))
+	{
+		return Effective->ControllingActID;
+	}
+
+	return -1;
+}
+
+const TMap<int32, FStageEffectiveEntityState>& AStage::GetEffectiveEntityStates() const
+{
+	if (bEffectiveEntityStatesDirty)
+	{
+		RebuildEffectiveEntityStates();
+	}
+	return EffectiveEntityStates;
+}
+
+void AStage::RebuildEffectiveEntityStates() const
+{
+	EffectiveEntityStates.Reset();
+
+	// Lowest to highest priority: later Acts overwrite earlier ones
+	for (int32 ActID : ActiveActIDs)
+	{
+		if (const FAct* Act = FindActByID(ActID))
 		{
-			if (const int32* State = Act->EntityStateOverrides.Find(EntityID))
+			for (const auto& Pair : Act->EntityStateOverrides)
 			{
-				return *State;
+				EffectiveEntityStates.Add(Pair.Key, FStageEffectiveEntityState(Pair.Value, ActID));
 			}
 		}
 	}
 
-	// Fallback: return current actual Entity state
-	return GetEntityStateByID(EntityID);
+	bEffectiveEntityStatesDirty = false;
 }
 
-int32 AStage::GetControllingActForEntity(int32 EntityID) const
+void AStage::ResolveEffectiveEntityState(int32 EntityID)
 {
 	// Iterate from highest priority (end) to lowest (beginning)
 	for (int32 i = ActiveActIDs.Num() - 1; i >= 0; --i)
 	{
-		int32 ActID = ActiveActIDs[i];
-		const FAct* Act = Acts.FindByPredicate([ActID](const FAct& A) {
-			return A.SUID.ActID == ActID;
-		});
-
-		if (Act && Act->EntityStateOverrides.Contains(EntityID))
+		const int32 ActID = ActiveActIDs[i];
+		if (const FAct* Act = FindActByID(ActID))
 		{
-			return ActID;
+			if (const int32* State = Act->EntityStateOverrides.Find(EntityID))
+			{
+				EffectiveEntityStates.Add(EntityID, FStageEffectiveEntityState(*State, ActID));
+				return;
+			}
 		}
 	}
 
-	return -1;
+	EffectiveEntityStates.Remove(EntityID);
 }
 
 int32 AStage::RegisterEntity(AActor* NewEntity)
+{
+	const int32 NewID = AllocateEntity(NewEntity);
+	if (NewID < 0) return -1;
+
+	// Auto-add to Default Act (ID 1), default state is 0 (Closed/Default)
+	FindOrAddDefaultAct().EntityStateOverrides.Add(NewID, 0);
+
+	MarkEffectiveEntityStatesDirty();
+
+	UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Registered Entity '%s' with ID %d and added to Default Act"), *GetName(), *NewEntity->GetName(), NewID);
+	return NewID;
+}
+
+TArray<int32> AStage::RegisterEntities(TArrayView<AActor* const> NewEntities)
+{
+	TArray<int32> NewIDs;
+	NewIDs.Reserve(NewEntities.Num());
+
+	EntityRegistry.Reserve(EntityRegistry.Num() + NewEntities.Num());
+
+	for (AActor* NewEntity : NewEntities)
+	{
+		NewIDs.Add(AllocateEntity(NewEntity));
+	}
+
+	// Add everything to the Default Act in one pass
+	FAct& DefaultAct = FindOrAddDefaultAct();
+	DefaultAct.EntityStateOverrides.Reserve(DefaultAct.EntityStateOverrides.Num() + NewEntities.Num());
+
+	int32 RegisteredCount = 0;
+	for (int32 NewID : NewIDs)
+	{
+		if (NewID >= 0)
+		{
+			DefaultAct.EntityStateOverrides.Add(NewID, 0);
+			++RegisteredCount;
+		}
+	}
+
+	if (RegisteredCount > 0)
+	{
+		MarkEffectiveEntityStatesDirty();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Registered %d/%d Entities and added them to Default Act"),
+		*GetName(), RegisteredCount, NewEntities.Num());
+	return NewIDs;
+}
+
+int32 AStage::AllocateEntity(AActor* NewEntity)
 {
 	if (!NewEntity) return -1;
 
@@ -1033,47 +1657,48 @@ int32 AStage::RegisterEntity(AActor* NewEntity)
 		return -1;
 	}
 
-	// Simple ID generation for Prototype: Find max ID + 1
-	int32 NewID = 1;
-	if (EntityRegistry.Num() > 0)
-	{
-		int32 MaxID = 0;
-		for (const auto& Pair : EntityRegistry)
-		{
-			if (Pair.Key > MaxID) MaxID = Pair.Key;
-		}
-		NewID = MaxID + 1;
-	}
+	// O(1) ID allocation from the persisted counter
+	const int32 NewID = NextEntityID++;
 
 	EntityRegistry.Add(NewID, NewEntity);
 	EntityComponent->SUID.StageID = SUID.StageID; // Sync Stage ID to Entity Component
 	EntityComponent->SUID.EntityID = NewID; // Sync Entity ID to Entity Component
 	EntityComponent->OwnerStage = this; // Set owner stage reference
 
-	// Auto-add to Default Act (ID 1)
-	FAct* DefaultAct = Acts.FindByPredicate([](const FAct& Act) {
-		return Act.SUID.ActID == 1;
-	});
+	return NewID;
+}
 
-	if (DefaultAct)
+FAct& AStage::FindOrAddDefaultAct()
+{
+	if (FAct* DefaultAct = FindActByID(1))
 	{
-		// Default state is 0 (Closed/Default)
-		DefaultAct->EntityStateOverrides.Add(NewID, 0);
+		return *DefaultAct;
 	}
-	else
+
+	// Should not happen if constructor works, but handle it just in case
+	FAct NewDefaultAct;
+	NewDefaultAct.SUID.StageID = SUID.StageID;
+	NewDefaultAct.SUID.ActID = 1;
+	NewDefaultAct.DisplayName = TEXT("Default Act");
+	NewDefaultAct.bFollowStageState = true; // Default Act follows Stage state
+	return Acts[AddAct(NewDefaultAct)];
+}
+
+void AStage::ValidateNextEntityID()
+{
+	// Levels saved before NextEntityID existed load with the default of 1
+	int32 MaxID = 0;
+	for (const auto& Pair : EntityRegistry)
 	{
-		// Should not happen if constructor works, but handle it just in case
-		FAct NewDefaultAct;
-		NewDefaultAct.SUID.StageID = SUID.StageID;
-		NewDefaultAct.SUID.ActID = 1;
-		NewDefaultAct.DisplayName = TEXT("Default Act");
-		NewDefaultAct.bFollowStageState = true; // Default Act follows Stage state
-		NewDefaultAct.EntityStateOverrides.Add(NewID, 0);
-		Acts.Add(NewDefaultAct);
+		MaxID = FMath::Max(MaxID, Pair.Key);
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Registered Entity '%s' with ID %d and added to Default Act"), *GetName(), *NewEntity->GetName(), NewID);
-	return NewID;
+	if (NextEntityID <= MaxID)
+	{
+		UE_LOG(LogStage, Verbose, TEXT("Stage [%s]: NextEntityID %d behind registry (max ID %d), advancing"),
+			*GetName(), NextEntityID, MaxID);
+		NextEntityID = MaxID + 1;
+	}
 }
 
 void AStage::UnregisterEntity(int32 EntityID)
@@ -1086,6 +1711,7 @@ void AStage::UnregisterEntity(int32 EntityID)
 	{
 		Act.EntityStateOverrides.Remove(EntityID);
 	}
+	EffectiveEntityStates.Remove(EntityID);
 	
 	UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Unregistered Entity ID %d from Stage and all Acts"), *GetName(), EntityID);
 }
@@ -1093,14 +1719,13 @@ void AStage::UnregisterEntity(int32 EntityID)
 void AStage::RemoveEntityFromAct(int32 EntityID, int32 ActID)
 {
 	// Find the Act
-	FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	FAct* TargetAct = FindActByID(ActID);
 	
 	if (TargetAct)
 	{
 		if (TargetAct->EntityStateOverrides.Remove(EntityID) > 0)
 		{
+			MarkEffectiveEntityStatesDirty();
 			UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Removed Entity ID %d from Act '%s'"), *GetName(), EntityID, *TargetAct->DisplayName);
 		}
 		else
@@ -1123,6 +1748,11 @@ void AStage::RemoveAct(int32 ActID)
 	
 	if (RemovedCount > 0)
 	{
+		// Removal shifts every following index
+		RebuildActIndex();
+		MarkEffectiveEntityStatesDirty();
+		++DebugRevision;
+		NotifyDataLayersChanged();
 		UE_LOG(LogTemp, Log, TEXT("Stage [%s]: Removed Act ID %d"), *GetName(), ActID);
 	}
 	else
@@ -1146,10 +1776,10 @@ AActor* AStage::GetEntityByID(int32 EntityID) const
 
 bool AStage::SetActDataLayerState(int32 ActID, EDataLayerRuntimeState NewState)
 {
+	TRACE_STAGE_SCOPE(Stage_SetActDataLayerState);
+
 	// Find the Act
-	const FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	const FAct* TargetAct = FindActByID(ActID);
 
 	if (!TargetAct)
 	{
@@ -1171,6 +1801,8 @@ bool AStage::SetActDataLayerState(int32 ActID, EDataLayerRuntimeState NewState)
 	}
 
 	bool bSuccess = DataLayerManager->SetDataLayerRuntimeState(TargetAct->AssociatedDataLayer, NewState);
+	TRACE_STAGE_ACT_DATALAYER_STATE(SUID.StageID, ActID, NewState, bSuccess);
+	RecordTimelineEvent(this, EStageTimelineEventType::ActDataLayerState, ActID, (uint8)NewState, bSuccess ? 1 : 0);
 
 	if (bSuccess)
 	{
@@ -1184,9 +1816,7 @@ bool AStage::SetActDataLayerState(int32 ActID, EDataLayerRuntimeState NewState)
 EDataLayerRuntimeState AStage::GetActDataLayerState(int32 ActID) const
 {
 	// Find the Act
-	const FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	const FAct* TargetAct = FindActByID(ActID);
 
 	if (!TargetAct || !TargetAct->AssociatedDataLayer)
 	{
@@ -1276,9 +1906,7 @@ EDataLayerRuntimeState AStage::GetStageDataLayerState() const
 
 UDataLayerAsset* AStage::GetActDataLayerAsset(int32 ActID) const
 {
-	const FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	const FAct* TargetAct = FindActByID(ActID);
 
 	if (TargetAct)
 	{
@@ -1294,9 +1922,9 @@ UDataLayerAsset* AStage::GetActDataLayerAsset(int32 ActID) const
 
 bool AStage::ApplyActEntityStatesOnly(int32 ActID)
 {
-	const FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	TRACE_STAGE_SCOPE(Stage_ApplyActEntityStatesOnly);
+
+	const FAct* TargetAct = FindActByID(ActID);
 
 	if (!TargetAct)
 	{
@@ -1304,7 +1932,18 @@ bool AStage::ApplyActEntityStatesOnly(int32 ActID)
 		return false;
 	}
 
+	// Inside a batch, only record the request; the final value is applied in EndActBatch()
+	if (IsInActBatch())
+	{
+		for (const auto& Pair : TargetAct->EntityStateOverrides)
+		{
+			PendingBatchEntityStates.Add(Pair.Key, Pair.Value);
+		}
+		return true;
+	}
+
 	// Apply Entity States only (no DataLayer changes)
+	TRACE_STAGE_ACT_ENTITY_STATES(SUID.StageID, ActID, TargetAct->EntityStateOverrides.Num());
 	for (const auto& Pair : TargetAct->EntityStateOverrides)
 	{
 		SetEntityStateByID(Pair.Key, Pair.Value);
@@ -1424,9 +2063,7 @@ bool AStage::DoesEntityExist(int32 EntityID) const
 
 FString AStage::GetActDisplayName(int32 ActID) const
 {
-	const FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	const FAct* TargetAct = FindActByID(ActID);
 
 	if (TargetAct)
 	{
@@ -1438,9 +2075,7 @@ FString AStage::GetActDisplayName(int32 ActID) const
 
 TMap<int32, int32> AStage::GetActEntityStates(int32 ActID) const
 {
-	const FAct* TargetAct = Acts.FindByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	const FAct* TargetAct = FindActByID(ActID);
 
 	if (TargetAct)
 	{
@@ -1462,9 +2097,79 @@ TArray<int32> AStage::GetAllActIDs() const
 
 bool AStage::DoesActExist(int32 ActID) const
 {
-	return Acts.ContainsByPredicate([ActID](const FAct& Act) {
-		return Act.SUID.ActID == ActID;
-	});
+	return FindActIndex(ActID) != INDEX_NONE;
+}
+
+FAct* AStage::FindActByID(int32 ActID)
+{
+	const int32 Index = FindActIndex(ActID);
+	return Index != INDEX_NONE ? &Acts[Index] : nullptr;
+}
+
+const FAct* AStage::FindActByID(int32 ActID) const
+{
+	const int32 Index = FindActIndex(ActID);
+	return Index != INDEX_NONE ? &Acts[Index] : nullptr;
+}
+
+int32 AStage::FindActIndex(int32 ActID) const
+{
+	const int32* CachedIndex = ActIndexByID.Find(ActID);
+	if (CachedIndex && Acts.IsValidIndex(*CachedIndex) && Acts[*CachedIndex].SUID.ActID == ActID)
+	{
+		return *CachedIndex;
+	}
+
+	// A plain miss is answered from the index: AddAct/RemoveAct/PostLoad/undo keep it consistent.
+	// Rebuild only if it is provably stale (entry points at another Act, or Acts changed size behind its back).
+	if (!CachedIndex && IndexedActCount == Acts.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	RebuildActIndex();
+	CachedIndex = ActIndexByID.Find(ActID);
+	return CachedIndex ? *CachedIndex : INDEX_NONE;
+}
+
+void AStage::RebuildActIndex() const
+{
+	ActIndexByID.Reset();
+	ActIndexByID.Reserve(Acts.Num());
+
+	for (int32 Index = 0; Index < Acts.Num(); ++Index)
+	{
+		// Keep the first occurrence to match the previous linear-search semantics
+		ActIndexByID.FindOrAdd(Acts[Index].SUID.ActID, Index);
+	}
+	IndexedActCount = Acts.Num();
+}
+
+int32 AStage::AddAct(const FAct& NewAct)
+{
+	const int32 NewIndex = Acts.Add(NewAct);
+	if (IndexedActCount == NewIndex)
+	{
+		ActIndexByID.FindOrAdd(NewAct.SUID.ActID, NewIndex);
+		IndexedActCount = Acts.Num();
+	}
+	++DebugRevision;
+	if (NewAct.AssociatedDataLayer)
+	{
+		NotifyDataLayersChanged();
+	}
+	return NewIndex;
+}
+
+void AStage::NotifyDataLayersChanged()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UStageManagerSubsystem* Subsystem = World->GetSubsystem<UStageManagerSubsystem>())
+		{
+			Subsystem->RefreshStageDataLayerIndex(this);
+		}
+	}
 }
 
 //----------------------------------------------------------------
@@ -1576,20 +2281,21 @@ void AStage::GotoState(EStageState TargetState)
 		switch (CurrentStageState)
 		{
 		case EStageRuntimeState::Unloaded:
-			// Need to load first, then activate
+			// Need to load first; Loaded continues to Active once streaming completes
+			bActivateWhenLoaded = true;
 			InternalGotoState(EStageRuntimeState::Preloading);
-			InternalGotoState(EStageRuntimeState::Active);
 			break;
 
 		case EStageRuntimeState::Preloading:
-			// Already loading, wait for completion
-			UE_LOG(LogStage, Verbose, TEXT("Stage [%s]: GotoState(Active) - still preloading"),
+			// Already loading, activate on completion
+			bActivateWhenLoaded = true;
+			UE_LOG(LogStage, Verbose, TEXT("Stage [%s]: GotoState(Active) - still preloading, will activate when loaded"),
 				*GetName());
 			break;
 
 		case EStageRuntimeState::Loaded:
-			// Ready to activate
-			InternalGotoState(EStageRuntimeState::Active);
+			// Ready to activate (within the scheduler's per-frame budget)
+			RequestStageActivation(nullptr);
 			break;
 
 		case EStageRuntimeState::Active:
@@ -1,8 +1,16 @@
 #include "Components/StageEntityComponent.h"
 #include "Actors/Stage.h"
+#include "Debug/StageStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "Engine/World.h"
+#include "Algo/AnyOf.h"
 
 #if WITH_EDITOR
 #include "Misc/MessageDialog.h"
+#include "Components/StageEntityRefreshQueue.h"
 #endif
 
 UStageEntityComponent::UStageEntityComponent()
@@ -10,11 +18,11 @@ UStageEntityComponent::UStageEntityComponent()
 	PrimaryComponentTick.bCanEverTick = false;
 }
 
-#if WITH_EDITOR
 void UStageEntityComponent::OnRegister()
 {
 	Super::OnRegister();
 
+#if WITH_EDITOR
 	// === Prevent adding StageEntityComponent to Stage actors ===
 	// Stage actors cannot be Entities (nested Stage is dangerous and not allowed)
 	if (AActor* Owner = GetOwner())
@@ -46,9 +54,41 @@ void UStageEntityComponent::OnRegister()
 			return;
 		}
 	}
-}
 #endif
 
+	// Components may have been recreated (e.g. construction-script rerun). Siblings can still be
+	// missing or unregistered here, so only drop the cache; targets resolve lazily on first apply.
+	InvalidateVisualTargets();
+	if (StateVisuals.Num() > 0)
+	{
+		ScheduleDeferredStateVisuals();
+	}
+}
+
+void UStageEntityComponent::ScheduleDeferredStateVisuals()
+{
+	if (PendingStateVisualsHandle.IsValid())
+	{
+		return;
+	}
+
+	// Next tick the owner has finished registering its components
+	TWeakObjectPtr<UStageEntityComponent> WeakThis(this);
+	PendingStateVisualsHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda([WeakThis](float)
+		{
+			if (UStageEntityComponent* Component = WeakThis.Get())
+			{
+				Component->PendingStateVisualsHandle.Reset();
+				if (Component->IsRegistered() && Component->StateVisuals.Num() > 0)
+				{
+					Component->ApplyStateVisuals(Component->EntityState);
+				}
+			}
+			return false; // One-shot
+		}));
+}
+
 void UStageEntityComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -63,23 +103,220 @@ void UStageEntityComponent::SetEntityState(int32 NewState, bool bForce)
 		// Store previous state before updating
 		PreviousEntityState = EntityState;
 		EntityState = NewState;
+		STAGE_STAT_EVENT(EntityStateChanges, 1);
 
-		// Notify listeners (Blueprints)
-		OnEntityStateChanged.Broadcast(EntityState, PreviousEntityState);
+		// Native visuals first: no Blueprint VM involved
+		if (StateVisuals.Num() > 0)
+		{
+			ApplyStateVisuals(EntityState);
+		}
 
 		UE_LOG(LogTemp, Verbose, TEXT("Entity Component [%s] (ID:%d) State Changed: %d -> %d"),
 			   *GetOwner()->GetName(), SUID.EntityID, PreviousEntityState, EntityState);
 
+		if (!ShouldBroadcastStateChanges())
+		{
+			return;
+		}
+
+		// Notify listeners (Blueprints)
+		OnEntityStateChanged.Broadcast(EntityState, PreviousEntityState);
+
 #if WITH_EDITOR
-		// Force visual update in Editor
+		// Visual update in Editor: deferred to end of frame so a batch of state changes
+		// (PreviewAct, ActivateAct, SetMultipleEntityStates) reruns each owner's construction script once
 		if (AActor* Owner = GetOwner())
 		{
-			Owner->RerunConstructionScripts();
+			FStageEntityRefreshQueue::Get().Enqueue(Owner);
 		}
 #endif
 	}
 }
 
+void UStageEntityComponent::ApplyStateVisuals(int32 State)
+{
+	// Game worlds only: an editor preview must never change what gets saved with the level
+	const UWorld* World = GetWorld();
+	if (!World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	ResolveVisualTargets();
+
+	// No entry (or a setting the entry leaves off) shows the original look, never the previous state's
+	const FStageEntityStateVisual* Visual = StateVisuals.Find(State);
+
+	for (const TWeakObjectPtr<UPrimitiveComponent>& WeakPrimitive : VisualPrimitiveTargets)
+	{
+		UPrimitiveComponent* Primitive = WeakPrimitive.Get();
+		const FVisualPrimitiveBase* Base = VisualPrimitiveBases.Find(WeakPrimitive);
+		if (!Primitive || !Base)
+		{
+			continue;
+		}
+
+		const bool bSetVisibility = Visual && Visual->bSetVisibility;
+		Primitive->SetVisibility(bSetVisibility ? Visual->bVisible : Base->bVisible);
+		Primitive->SetHiddenInGame(bSetVisibility ? !Visual->bVisible : Base->bHiddenInGame);
+
+		const FName CollisionProfile = Visual && Visual->bSetCollisionProfile ? Visual->CollisionProfile.Name : Base->CollisionProfile;
+		if (Primitive->GetCollisionProfileName() != CollisionProfile)
+		{
+			Primitive->SetCollisionProfileName(CollisionProfile);
+		}
+	}
+
+	if (UStaticMeshComponent* MeshComponent = VisualMeshTarget.Get())
+	{
+		UStaticMesh* StaticMesh = Visual && Visual->StaticMesh ? Visual->StaticMesh.Get() : VisualBaseStaticMesh.Get();
+		if (StaticMesh)
+		{
+			MeshComponent->SetStaticMesh(StaticMesh);
+		}
+
+		// Per slot: this state's override, else the original override (None = mesh default)
+		const int32 NumSlots = FMath::Max3(MeshComponent->OverrideMaterials.Num(), VisualBaseMaterials.Num(),
+			Visual ? Visual->MaterialOverrides.Num() : 0);
+		for (int32 SlotIndex = 0; SlotIndex < NumSlots; ++SlotIndex)
+		{
+			UMaterialInterface* Material = Visual && Visual->MaterialOverrides.IsValidIndex(SlotIndex) ? Visual->MaterialOverrides[SlotIndex].Get() : nullptr;
+			if (!Material && VisualBaseMaterials.IsValidIndex(SlotIndex))
+			{
+				Material = VisualBaseMaterials[SlotIndex].Get();
+			}
+
+			const UMaterialInterface* Current = MeshComponent->OverrideMaterials.IsValidIndex(SlotIndex) ? MeshComponent->OverrideMaterials[SlotIndex].Get() : nullptr;
+			if (Current != Material)
+			{
+				MeshComponent->SetMaterial(SlotIndex, Material);
+			}
+		}
+	}
+
+	if (USceneComponent* TransformTarget = VisualTransformTarget.Get())
+	{
+		// Capture the un-offset transform once per target object, so offsets never accumulate
+		if (VisualBaseTransformOwner.Get() != TransformTarget)
+		{
+			VisualBaseTransformOwner = TransformTarget;
+			VisualBaseRelativeTransform = TransformTarget->GetRelativeTransform();
+		}
+
+		TransformTarget->SetRelativeTransform(Visual && Visual->bApplyTransformOffset
+			? Visual->TransformOffset * VisualBaseRelativeTransform
+			: VisualBaseRelativeTransform);
+	}
+}
+
+void UStageEntityComponent::ResolveVisualTargets()
+{
+	if (bVisualTargetsResolved)
+	{
+		return;
+	}
+	bVisualTargetsResolved = true;
+
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	TInlineComponentArray<USceneComponent*> SceneComponents(Owner);
+	for (USceneComponent* SceneComponent : SceneComponents)
+	{
+		if (!VisualTargetComponentName.IsNone() && SceneComponent->GetFName() != VisualTargetComponentName)
+		{
+			continue;
+		}
+
+		if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(SceneComponent))
+		{
+			VisualPrimitiveTargets.Add(Primitive);
+		}
+		if (!VisualMeshTarget.IsValid())
+		{
+			VisualMeshTarget = Cast<UStaticMeshComponent>(SceneComponent);
+		}
+		if (!VisualTargetComponentName.IsNone())
+		{
+			VisualTransformTarget = SceneComponent;
+		}
+	}
+
+	if (VisualTargetComponentName.IsNone())
+	{
+		VisualTransformTarget = Owner->GetRootComponent();
+	}
+
+	// Only track targets some state actually changes
+	const bool bAnyPrimitiveSetting = Algo::AnyOf(StateVisuals, [](const TPair<int32, FStageEntityStateVisual>& Pair)
+	{
+		return Pair.Value.bSetVisibility || Pair.Value.bSetCollisionProfile;
+	});
+	const bool bAnyMeshSetting = Algo::AnyOf(StateVisuals, [](const TPair<int32, FStageEntityStateVisual>& Pair)
+	{
+		return Pair.Value.StaticMesh || Pair.Value.MaterialOverrides.Num() > 0;
+	});
+	const bool bAnyTransformOffset = Algo::AnyOf(StateVisuals, [](const TPair<int32, FStageEntityStateVisual>& Pair)
+	{
+		return Pair.Value.bApplyTransformOffset;
+	});
+	if (!bAnyPrimitiveSetting)
+	{
+		VisualPrimitiveTargets.Reset();
+	}
+	if (!bAnyMeshSetting)
+	{
+		VisualMeshTarget.Reset();
+	}
+	if (!bAnyTransformOffset)
+	{
+		VisualTransformTarget.Reset();
+	}
+
+	// Capture the original look once per target object, before any state changes it
+	for (auto It = VisualPrimitiveBases.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (const TWeakObjectPtr<UPrimitiveComponent>& WeakPrimitive : VisualPrimitiveTargets)
+	{
+		if (!VisualPrimitiveBases.Contains(WeakPrimitive))
+		{
+			const UPrimitiveComponent* Primitive = WeakPrimitive.Get();
+			FVisualPrimitiveBase& Base = VisualPrimitiveBases.Add(WeakPrimitive);
+			Base.bVisible = Primitive->GetVisibleFlag();
+			Base.bHiddenInGame = Primitive->bHiddenInGame;
+			Base.CollisionProfile = Primitive->GetCollisionProfileName();
+		}
+	}
+
+	UStaticMeshComponent* MeshComponent = VisualMeshTarget.Get();
+	if (MeshComponent && VisualBaseMeshOwner.Get() != MeshComponent)
+	{
+		VisualBaseMeshOwner = MeshComponent;
+		VisualBaseStaticMesh = MeshComponent->GetStaticMesh();
+		VisualBaseMaterials.Reset(MeshComponent->OverrideMaterials.Num());
+		for (UMaterialInterface* Material : MeshComponent->OverrideMaterials)
+		{
+			VisualBaseMaterials.Add(Material);
+		}
+	}
+}
+
+void UStageEntityComponent::InvalidateVisualTargets()
+{
+	VisualPrimitiveTargets.Reset();
+	VisualMeshTarget.Reset();
+	VisualTransformTarget.Reset();
+	bVisualTargetsResolved = false;
+}
+
 AStage* UStageEntityComponent::GetOwnerStage() const
 {
 	return OwnerStage.Get();
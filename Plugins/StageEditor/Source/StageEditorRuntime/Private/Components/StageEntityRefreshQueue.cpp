@@ -0,0 +1,101 @@
+#include "Components/StageEntityRefreshQueue.h"
+
+#if WITH_EDITOR
+#include "GameFramework/Actor.h"
+#include "Misc/CoreDelegates.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogStageEntityRefresh, Log, All);
+
+FStageEntityRefreshQueue& FStageEntityRefreshQueue::Get()
+{
+	static FStageEntityRefreshQueue Instance;
+	return Instance;
+}
+
+void FStageEntityRefreshQueue::Enqueue(AActor* Owner)
+{
+	if (!Owner)
+	{
+		return;
+	}
+
+	bool bAlreadyPending = false;
+	PendingOwnerSet.Add(Owner, &bAlreadyPending);
+	if (bAlreadyPending)
+	{
+		return;
+	}
+
+	PendingOwners.Add(Owner);
+
+	if (!EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FStageEntityRefreshQueue::HandleEndFrame);
+	}
+}
+
+void FStageEntityRefreshQueue::Flush()
+{
+	ProcessPending(0.0);
+}
+
+void FStageEntityRefreshQueue::Shutdown()
+{
+	if (EndFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+
+	PendingOwners.Reset();
+	PendingOwnerSet.Reset();
+	NextPendingIndex = 0;
+}
+
+void FStageEntityRefreshQueue::HandleEndFrame()
+{
+	ProcessPending(FrameBudgetSeconds);
+}
+
+void FStageEntityRefreshQueue::ProcessPending(double BudgetSeconds)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 StartIndex = NextPendingIndex;
+
+	while (NextPendingIndex < PendingOwners.Num())
+	{
+		// Remove from the set first: the rerun may change state again and re-enqueue this owner
+		const TWeakObjectPtr<AActor> WeakOwner = PendingOwners[NextPendingIndex++];
+		PendingOwnerSet.Remove(WeakOwner);
+
+		if (AActor* Owner = WeakOwner.Get())
+		{
+			Owner->RerunConstructionScripts();
+		}
+
+		if (BudgetSeconds > 0.0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	const int32 ProcessedCount = NextPendingIndex - StartIndex;
+	if (ProcessedCount > 0)
+	{
+		UE_LOG(LogStageEntityRefresh, Verbose, TEXT("Reran %d Entity construction scripts (%.2f ms), %d pending"),
+			ProcessedCount, (FPlatformTime::Seconds() - StartTime) * 1000.0, GetPendingCount());
+	}
+
+	if (NextPendingIndex >= PendingOwners.Num())
+	{
+		PendingOwners.Reset();
+		NextPendingIndex = 0;
+
+		if (EndFrameHandle.IsValid())
+		{
+			FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+			EndFrameHandle.Reset();
+		}
+	}
+}
+#endif
@@ -1,5 +1,6 @@
 #include "Components/StageTriggerZoneComponent.h"
 #include "Actors/Stage.h"
+#include "Subsystems/StageManagerSubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogStageTriggerZone, Log, All);
 
@@ -81,6 +82,15 @@ void UStageTriggerZoneComponent::BindToStage(AStage* Stage)
 
 	BoundStage = Stage;
 
+	// Proximity streaming drives enter/exit from the subsystem's grid; predictive preload queries it
+	if (UStageManagerSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UStageManagerSubsystem>() : nullptr)
+	{
+		if (Subsystem->IsProximityGridActive())
+		{
+			Subsystem->RegisterProximityZone(this);
+		}
+	}
+
 	UE_LOG(LogStageTriggerZone, Log, TEXT("StageTriggerZone [%s] (%s): Bound to Stage '%s'"),
 		*GetName(),
 		ZoneType == EStageTriggerZoneType::LoadZone ? TEXT("LoadZone") : TEXT("ActivateZone"),
@@ -94,6 +104,11 @@ void UStageTriggerZoneComponent::UnbindFromStage()
 		UE_LOG(LogStageTriggerZone, Log, TEXT("StageTriggerZone [%s]: Unbound from Stage '%s'"),
 			*GetName(), *BoundStage->GetName());
 		BoundStage.Reset();
+
+		if (UStageManagerSubsystem* Subsystem = GetWorld() ? GetWorld()->GetSubsystem<UStageManagerSubsystem>() : nullptr)
+		{
+			Subsystem->UnregisterProximityZone(this);
+		}
 	}
 }
 
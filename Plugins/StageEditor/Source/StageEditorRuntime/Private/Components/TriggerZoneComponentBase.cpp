@@ -1,6 +1,7 @@
 #include "Components/TriggerZoneComponentBase.h"
 #include "Actors/Stage.h"
 #include "GameFramework/Pawn.h"
+#include "Debug/StageTrace.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogTriggerZone, Log, All);
 
@@ -180,6 +181,19 @@ void UTriggerZoneComponentBase::UnbindOverlapEvents()
 void UTriggerZoneComponentBase::OnZoneBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
+	NotifyActorEnter(OtherActor);
+}
+
+void UTriggerZoneComponentBase::OnZoneEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
+	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+	NotifyActorExit(OtherActor);
+}
+
+void UTriggerZoneComponentBase::NotifyActorEnter(AActor* Actor)
+{
+	TRACE_STAGE_SCOPE(TriggerZone_NotifyActorEnter);
+
 	// Check if zone is enabled
 	if (!bZoneEnabled)
 	{
@@ -187,24 +201,25 @@ void UTriggerZoneComponentBase::OnZoneBeginOverlap(UPrimitiveComponent* Overlapp
 	}
 
 	// Filter check
-	if (!ShouldTriggerForActor(OtherActor))
+	if (!ShouldTriggerForActor(Actor))
 	{
 		return;
 	}
 
 	UE_LOG(LogTriggerZone, Verbose, TEXT("TriggerZone [%s]: Actor '%s' entered"),
-		*GetName(), *OtherActor->GetName());
+		*GetName(), *Actor->GetName());
 
 	// Call virtual handler (allows derived classes to add behavior)
-	HandleActorEnter(OtherActor);
+	HandleActorEnter(Actor);
 
 	// Broadcast Blueprint event
-	OnActorEnter.Broadcast(this, OtherActor);
+	OnActorEnter.Broadcast(this, Actor);
 }
 
-void UTriggerZoneComponentBase::OnZoneEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+void UTriggerZoneComponentBase::NotifyActorExit(AActor* Actor)
 {
+	TRACE_STAGE_SCOPE(TriggerZone_NotifyActorExit);
+
 	// Check if zone is enabled
 	if (!bZoneEnabled)
 	{
@@ -212,19 +227,39 @@ void UTriggerZoneComponentBase::OnZoneEndOverlap(UPrimitiveComponent* Overlapped
 	}
 
 	// Filter check
-	if (!ShouldTriggerForActor(OtherActor))
+	if (!ShouldTriggerForActor(Actor))
 	{
 		return;
 	}
 
 	UE_LOG(LogTriggerZone, Verbose, TEXT("TriggerZone [%s]: Actor '%s' exited"),
-		*GetName(), *OtherActor->GetName());
+		*GetName(), *Actor->GetName());
 
 	// Call virtual handler (allows derived classes to add behavior)
-	HandleActorExit(OtherActor);
+	HandleActorExit(Actor);
 
 	// Broadcast Blueprint event
-	OnActorExit.Broadcast(this, OtherActor);
+	OnActorExit.Broadcast(this, Actor);
+}
+
+bool UTriggerZoneComponentBase::IsPointInZone(const FVector& WorldLocation, float Padding) const
+{
+	// Local space removes rotation and scale, so compare against the unscaled extent
+	const FTransform& Transform = GetComponentTransform();
+	const FVector Local = Transform.InverseTransformPosition(WorldLocation);
+	const FVector Extent = GetUnscaledBoxExtent() + (Padding > 0.0f ? FVector(Padding) / Transform.GetScale3D().GetAbs().ComponentMax(FVector(UE_KINDA_SMALL_NUMBER)) : FVector::ZeroVector);
+	return FMath::Abs(Local.X) <= Extent.X &&
+		FMath::Abs(Local.Y) <= Extent.Y &&
+		FMath::Abs(Local.Z) <= Extent.Z;
+}
+
+bool UTriggerZoneComponentBase::DoesSegmentIntersectZone(const FVector& Start, const FVector& End) const
+{
+	const FTransform& Transform = GetComponentTransform();
+	const FVector LocalStart = Transform.InverseTransformPosition(Start);
+	const FVector LocalEnd = Transform.InverseTransformPosition(End);
+	const FVector Extent = GetUnscaledBoxExtent();
+	return FMath::LineBoxIntersection(FBox(-Extent, Extent), LocalStart, LocalEnd, LocalEnd - LocalStart);
 }
 
 void UTriggerZoneComponentBase::HandleActorEnter(AActor* Actor)
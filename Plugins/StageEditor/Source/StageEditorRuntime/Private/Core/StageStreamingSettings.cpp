@@ -0,0 +1,10 @@
+#include "Core/StageStreamingSettings.h"
+
+UStageStreamingSettings::UStageStreamingSettings()
+{
+}
+
+UStageStreamingSettings* UStageStreamingSettings::Get()
+{
+	return GetMutableDefault<UStageStreamingSettings>();
+}
@@ -14,10 +14,22 @@ void AStageDebugHUD::DrawHUD()
 {
 	Super::DrawHUD();
 
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	DrawStageDebug();
+	RecordFrameCost(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
+void AStageDebugHUD::DrawStageDebug()
+{
 	// Check if enabled
 	UStageDebugSettings* Settings = UStageDebugSettings::Get();
 	if (!Settings || !Settings->bEnableDebugHUD)
 	{
+		if (StageLineCache.Num() > 0)
+		{
+			StageLineCache.Empty();
+			HeaderKey.Reset();
+		}
 		return;
 	}
 
@@ -28,34 +40,26 @@ void AStageDebugHUD::DrawHUD()
 	UStageManagerSubsystem* Subsystem = World->GetSubsystem<UStageManagerSubsystem>();
 	if (!Subsystem) return;
 
+	if (!Canvas) return;
+
 	// Calculate start position
 	FVector2D StartPos = GetStartPosition();
 	float YOffset = StartPos.Y;
 	const float Scale = Settings->TextScale;
 	const float ScaledLineHeight = LineHeight * Scale;
 
-	// Get watch list and all stages info
-	TArray<int32> WatchedIDs = Subsystem->GetWatchedStageIDs();
-	int32 TotalStageCount = Subsystem->GetRegisteredStageCount();
+	const TSet<int32>& WatchedIDs = Subsystem->GetWatchedStageIDSet();
 
-	if (!Canvas) return;
+	// Header, streaming metrics and separator (rebuilt only when a counter changes)
+	UpdateHeaderLines(Subsystem, WatchedIDs.Num());
+	DrawLines(HeaderLines, StartPos.X, YOffset, Scale);
 
-	// Draw header with watch count
-	FString Header;
-	if (WatchedIDs.Num() > 0)
+	// HUD self-cost (previous frames; this frame is still being measured)
+	if (Settings->bShowHUDFrameCost && !FrameCostText.IsEmpty())
 	{
-		Header = FString::Printf(TEXT("=== Stage Debug (%d/%d) ==="), WatchedIDs.Num(), TotalStageCount);
-	}
-	else
-	{
-		Header = FString::Printf(TEXT("=== Stage Debug (0/%d) ==="), TotalStageCount);
+		DrawText(FrameCostText, FLinearColor(0.5f, 0.5f, 0.5f), StartPos.X, YOffset, nullptr, Scale * 0.8f);
+		YOffset += ScaledLineHeight * 0.8f;
 	}
-	DrawText(Header, FLinearColor::Yellow, StartPos.X, YOffset, nullptr, Scale);
-	YOffset += ScaledLineHeight;
-
-	// Draw separator
-	DrawText(TEXT("─────────────────────────"), FLinearColor(0.5f, 0.5f, 0.5f), StartPos.X, YOffset, nullptr, Scale * 0.8f);
-	YOffset += ScaledLineHeight * 0.8f;
 
 	// Check if watch list is empty
 	if (WatchedIDs.Num() == 0)
@@ -66,6 +70,11 @@ void AStageDebugHUD::DrawHUD()
 		DrawText(TEXT("Use: Stage.Watch <ID>"), FLinearColor(0.5f, 0.5f, 0.5f), StartPos.X, YOffset, nullptr, Scale * 0.8f);
 		YOffset += ScaledLineHeight * 0.8f;
 		DrawText(TEXT("  or Stage.WatchAll"), FLinearColor(0.5f, 0.5f, 0.5f), StartPos.X, YOffset, nullptr, Scale * 0.8f);
+
+		if (StageLineCache.Num() > 0)
+		{
+			StageLineCache.Empty();
+		}
 		return;
 	}
 
@@ -75,14 +84,150 @@ void AStageDebugHUD::DrawHUD()
 		AStage* Stage = Subsystem->GetStage(StageID);
 		if (!Stage) continue;
 
-		if (Settings->bDetailedMode)
+		DrawLines(GetStageLines(Stage, Settings->bDetailedMode), StartPos.X, YOffset, Scale);
+	}
+
+	// Drop entries for Stages that were unwatched
+	if (StageLineCache.Num() > WatchedIDs.Num())
+	{
+		for (auto It = StageLineCache.CreateIterator(); It; ++It)
+		{
+			if (!WatchedIDs.Contains(It.Key()))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+//----------------------------------------------------------------
+// Cached Layout
+//----------------------------------------------------------------
+
+void AStageDebugHUD::UpdateHeaderLines(const UStageManagerSubsystem* Subsystem, int32 WatchedCount)
+{
+	const bool bPredictiveActive = Subsystem->IsPredictivePreloadActive();
+
+	TArray<int32, TInlineAllocator<8>> NewKey;
+	NewKey.Add(WatchedCount);
+	NewKey.Add(Subsystem->GetRegisteredStageCount());
+	NewKey.Add(bPredictiveActive ? 1 : 0);
+	NewKey.Add(bPredictiveActive ? Subsystem->GetPredictedStageLoadCount() : 0);
+	NewKey.Add(bPredictiveActive ? Subsystem->GetReactiveStageLoadCount() : 0);
+	NewKey.Add(bPredictiveActive ? Subsystem->GetExpiredPredictiveLoadCount() : 0);
+	NewKey.Add(Subsystem->GetAvoidedUnloadCount());
+
+	if (NewKey == HeaderKey && HeaderLines.Num() > 0)
+	{
+		return;
+	}
+	HeaderKey = NewKey;
+	HeaderLines.Reset();
+
+	// Header with watch count
+	FCachedLine& Header = HeaderLines.AddDefaulted_GetRef();
+	Header.Text = FString::Printf(TEXT("=== Stage Debug (%d/%d) ==="), WatchedCount, NewKey[1]);
+	Header.Color = FLinearColor::Yellow;
+
+	// Streaming metrics (only when predictive preloading is running)
+	if (bPredictiveActive)
+	{
+		FCachedLine& LoadStats = HeaderLines.AddDefaulted_GetRef();
+		LoadStats.Text = FString::Printf(TEXT("Loads: %d predicted / %d reactive / %d expired"), NewKey[3], NewKey[4], NewKey[5]);
+		LoadStats.Color = FLinearColor(0.7f, 0.7f, 0.7f);
+		LoadStats.ScaleFactor = 0.8f;
+		LoadStats.AdvanceFactor = 0.8f;
+	}
+
+	// Unload hysteresis savings
+	if (NewKey[6] > 0)
+	{
+		FCachedLine& UnloadStats = HeaderLines.AddDefaulted_GetRef();
+		UnloadStats.Text = FString::Printf(TEXT("Unload cycles avoided: %d"), NewKey[6]);
+		UnloadStats.Color = FLinearColor(0.7f, 0.7f, 0.7f);
+		UnloadStats.ScaleFactor = 0.8f;
+		UnloadStats.AdvanceFactor = 0.8f;
+	}
+
+	// Separator
+	FCachedLine& Separator = HeaderLines.AddDefaulted_GetRef();
+	Separator.Text = TEXT("─────────────────────────");
+	Separator.Color = FLinearColor(0.5f, 0.5f, 0.5f);
+	Separator.ScaleFactor = 0.8f;
+	Separator.AdvanceFactor = 0.8f;
+}
+
+const TArray<AStageDebugHUD::FCachedLine>& AStageDebugHUD::GetStageLines(AStage* Stage, bool bDetailedMode)
+{
+	FCachedStageLines& Cached = StageLineCache.FindOrAdd(Stage->GetStageID());
+
+	// Act/state/lock changes bump the revision; zone counts and DataLayer streaming do not broadcast, so compare them directly
+	const EDataLayerRuntimeState DataLayerState = Stage->GetStageDataLayerState();
+	const int32 LoadZoneCount = Stage->OverlappingLoadZoneActors.Num();
+	const int32 ActivateZoneCount = Stage->OverlappingActivateZoneActors.Num();
+	const int32 AvoidedUnloadCount = Stage->GetAvoidedUnloadCount();
+	const bool bUnloadPending = Stage->IsUnloadPending();
+
+	const bool bUpToDate = Cached.bValid
+		&& Cached.DebugRevision == Stage->GetDebugRevision()
+		&& Cached.bDetailedMode == bDetailedMode
+		&& Cached.DataLayerState == DataLayerState
+		&& Cached.LoadZoneCount == LoadZoneCount
+		&& Cached.ActivateZoneCount == ActivateZoneCount
+		&& Cached.AvoidedUnloadCount == AvoidedUnloadCount
+		&& Cached.bUnloadPending == bUnloadPending;
+
+	if (!bUpToDate)
+	{
+		Cached.DebugRevision = Stage->GetDebugRevision();
+		Cached.bDetailedMode = bDetailedMode;
+		Cached.DataLayerState = DataLayerState;
+		Cached.LoadZoneCount = LoadZoneCount;
+		Cached.ActivateZoneCount = ActivateZoneCount;
+		Cached.AvoidedUnloadCount = AvoidedUnloadCount;
+		Cached.bUnloadPending = bUnloadPending;
+		Cached.bValid = true;
+
+		Cached.Lines.Reset();
+		if (bDetailedMode)
 		{
-			DrawStageDetailed(Stage, StartPos.X, YOffset);
+			BuildStageDetailedLines(Stage, Cached.Lines);
 		}
 		else
 		{
-			DrawStageSimple(Stage, StartPos.X, YOffset);
+			BuildStageSimpleLines(Stage, Cached.Lines);
+		}
+	}
+
+	return Cached.Lines;
+}
+
+void AStageDebugHUD::DrawLines(const TArray<FCachedLine>& Lines, float X, float& YOffset, float Scale)
+{
+	const float ScaledLineHeight = LineHeight * Scale;
+	const float Indent = IndentWidth * Scale;
+
+	for (const FCachedLine& Line : Lines)
+	{
+		if (!Line.Text.IsEmpty())
+		{
+			DrawText(Line.Text, Line.Color, X + Indent * Line.IndentLevel, YOffset, nullptr, Scale * Line.ScaleFactor);
 		}
+		YOffset += ScaledLineHeight * Line.AdvanceFactor;
+	}
+}
+
+void AStageDebugHUD::RecordFrameCost(double Milliseconds)
+{
+	AverageDrawMs = AverageDrawMs > 0.0 ? FMath::Lerp(AverageDrawMs, Milliseconds, 0.1) : Milliseconds;
+	WindowPeakDrawMs = FMath::Max(WindowPeakDrawMs, Milliseconds);
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (NowSeconds - WindowStartSeconds >= FrameCostWindowSeconds)
+	{
+		FrameCostText = FString::Printf(TEXT("HUD: %.3f ms avg / %.3f ms peak"), AverageDrawMs, WindowPeakDrawMs);
+		WindowPeakDrawMs = 0.0;
+		WindowStartSeconds = NowSeconds;
 	}
 }
 
@@ -117,13 +262,11 @@ FVector2D AStageDebugHUD::GetStartPosition() const
 	}
 }
 
-void AStageDebugHUD::DrawStageSimple(AStage* Stage, float X, float& YOffset)
+void AStageDebugHUD::BuildStageSimpleLines(AStage* Stage, TArray<FCachedLine>& OutLines) const
 {
-	UStageDebugSettings* Settings = UStageDebugSettings::Get();
-	const float Scale = Settings ? Settings->TextScale : 1.0f;
-
 	// Format: StageName: State | DL: DataLayerState
-	FString Text = FString::Printf(TEXT("%s: %s | DL: %s"),
+	FCachedLine& Line = OutLines.AddDefaulted_GetRef();
+	Line.Text = FString::Printf(TEXT("%s: %s | DL: %s"),
 		*Stage->GetStageName(),
 		*StateToString(Stage->GetCurrentStageState()),
 		*DataLayerStateToString(Stage->GetStageDataLayerState()));
@@ -131,82 +274,77 @@ void AStageDebugHUD::DrawStageSimple(AStage* Stage, float X, float& YOffset)
 	// Add lock indicator
 	if (Stage->IsStageStateLocked())
 	{
-		Text += TEXT(" [LOCKED]");
+		Line.Text += TEXT(" [LOCKED]");
 	}
 
-	FLinearColor Color = GetStateColor(Stage->GetCurrentStageState());
-	DrawText(Text, Color, X, YOffset, nullptr, Scale);
-	YOffset += LineHeight * Scale;
+	Line.Color = GetStateColor(Stage->GetCurrentStageState());
 }
 
-void AStageDebugHUD::DrawStageDetailed(AStage* Stage, float X, float& YOffset)
+void AStageDebugHUD::BuildStageDetailedLines(AStage* Stage, TArray<FCachedLine>& OutLines) const
 {
-	UStageDebugSettings* Settings = UStageDebugSettings::Get();
-	const float Scale = Settings ? Settings->TextScale : 1.0f;
-	const float ScaledLineHeight = LineHeight * Scale;
-	const float Indent = IndentWidth * Scale;
-	const float SubScale = Scale * 0.9f;
+	const float SubScale = 0.9f;
+	const FLinearColor TextColor = FLinearColor::White;
+	const FLinearColor DimColor = FLinearColor(0.7f, 0.7f, 0.7f);
 
-	FLinearColor StateColor = GetStateColor(Stage->GetCurrentStageState());
-	FLinearColor TextColor = FLinearColor::White;
-	FLinearColor DimColor = FLinearColor(0.7f, 0.7f, 0.7f);
+	auto AddSubLine = [&OutLines, SubScale](FString&& Text, const FLinearColor& Color)
+	{
+		FCachedLine& Line = OutLines.AddDefaulted_GetRef();
+		Line.Text = MoveTemp(Text);
+		Line.Color = Color;
+		Line.IndentLevel = 1.0f;
+		Line.ScaleFactor = SubScale;
+	};
 
 	// Stage name and ID
-	FString Header = FString::Printf(TEXT("%s (ID:%d)"),
-		*Stage->GetStageName(), Stage->GetStageID());
-	DrawText(Header, StateColor, X, YOffset, nullptr, Scale);
-	YOffset += ScaledLineHeight;
+	FCachedLine& Header = OutLines.AddDefaulted_GetRef();
+	Header.Text = FString::Printf(TEXT("%s (ID:%d)"), *Stage->GetStageName(), Stage->GetStageID());
+	Header.Color = GetStateColor(Stage->GetCurrentStageState());
 
 	// State
-	FString StateText = FString::Printf(TEXT("├─ State: %s%s"),
+	AddSubLine(FString::Printf(TEXT("├─ State: %s%s"),
 		*StateToString(Stage->GetCurrentStageState()),
-		Stage->IsStageStateLocked() ? TEXT(" (Locked)") : TEXT(""));
-	DrawText(StateText, TextColor, X + Indent, YOffset, nullptr, SubScale);
-	YOffset += ScaledLineHeight;
+		Stage->IsStageStateLocked() ? TEXT(" (Locked)") : TEXT("")), TextColor);
 
 	// DataLayer State
-	FString DLText = FString::Printf(TEXT("├─ DataLayer: %s"),
-		*DataLayerStateToString(Stage->GetStageDataLayerState()));
-	FLinearColor DLColor = GetDataLayerStateColor(Stage->GetStageDataLayerState());
-	DrawText(DLText, DLColor, X + Indent, YOffset, nullptr, SubScale);
-	YOffset += ScaledLineHeight;
+	AddSubLine(FString::Printf(TEXT("├─ DataLayer: %s"),
+		*DataLayerStateToString(Stage->GetStageDataLayerState())),
+		GetDataLayerStateColor(Stage->GetStageDataLayerState()));
 
 	// Active Acts
-	TArray<int32> ActiveActs = Stage->GetActiveActIDs();
-	TArray<int32> AllActs = Stage->GetAllActIDs();
+	const TArray<int32> AllActs = Stage->GetAllActIDs();
 	FString ActsStr;
 	for (int32 ActID : AllActs)
 	{
 		if (!ActsStr.IsEmpty()) ActsStr += TEXT(", ");
-		bool bIsActive = ActiveActs.Contains(ActID);
-		bool bIsLocked = Stage->IsActLocked(ActID);
-		ActsStr += FString::Printf(TEXT("%d%s%s"),
-			ActID,
-			bIsActive ? TEXT("✓") : TEXT(""),
-			bIsLocked ? TEXT("🔒") : TEXT(""));
+		ActsStr.AppendInt(ActID);
+		if (Stage->IsActActive(ActID)) ActsStr += TEXT("✓");
+		if (Stage->IsActLocked(ActID)) ActsStr += TEXT("🔒");
 	}
-	FString ActsText = FString::Printf(TEXT("├─ Acts: [%s]"), *ActsStr);
-	DrawText(ActsText, TextColor, X + Indent, YOffset, nullptr, SubScale);
-	YOffset += ScaledLineHeight;
+	AddSubLine(FString::Printf(TEXT("├─ Acts: [%s]"), *ActsStr), TextColor);
 
 	// Zone Actor Counts
-	int32 LoadZoneCount = Stage->OverlappingLoadZoneActors.Num();
-	int32 ActivateZoneCount = Stage->OverlappingActivateZoneActors.Num();
+	const int32 LoadZoneCount = Stage->OverlappingLoadZoneActors.Num();
+	const int32 ActivateZoneCount = Stage->OverlappingActivateZoneActors.Num();
 
 	FString LoadZoneText = FString::Printf(TEXT("├─ LoadZone: %d actor%s"),
 		LoadZoneCount, LoadZoneCount == 1 ? TEXT("") : TEXT("s"));
-	FLinearColor LoadZoneColor = LoadZoneCount > 0 ? FLinearColor::Green : DimColor;
-	DrawText(LoadZoneText, LoadZoneColor, X + Indent, YOffset, nullptr, SubScale);
-	YOffset += ScaledLineHeight;
+	if (Stage->IsUnloadPending())
+	{
+		LoadZoneText += TEXT(" (unload pending)");
+	}
+	if (Stage->GetAvoidedUnloadCount() > 0)
+	{
+		LoadZoneText += FString::Printf(TEXT(" | avoided %d"), Stage->GetAvoidedUnloadCount());
+	}
+	AddSubLine(MoveTemp(LoadZoneText), LoadZoneCount > 0 ? FLinearColor::Green : DimColor);
 
-	FString ActivateZoneText = FString::Printf(TEXT("└─ ActivateZone: %d actor%s"),
-		ActivateZoneCount, ActivateZoneCount == 1 ? TEXT("") : TEXT("s"));
-	FLinearColor ActivateZoneColor = ActivateZoneCount > 0 ? FLinearColor::Green : DimColor;
-	DrawText(ActivateZoneText, ActivateZoneColor, X + Indent, YOffset, nullptr, SubScale);
-	YOffset += ScaledLineHeight;
+	AddSubLine(FString::Printf(TEXT("└─ ActivateZone: %d actor%s"),
+		ActivateZoneCount, ActivateZoneCount == 1 ? TEXT("") : TEXT("s")),
+		ActivateZoneCount > 0 ? FLinearColor::Green : DimColor);
 
 	// Spacing between Stages
-	YOffset += ScaledLineHeight * 0.3f;
+	FCachedLine& Spacer = OutLines.AddDefaulted_GetRef();
+	Spacer.AdvanceFactor = 0.3f;
 }
 
 FLinearColor AStageDebugHUD::GetStateColor(EStageRuntimeState State) const
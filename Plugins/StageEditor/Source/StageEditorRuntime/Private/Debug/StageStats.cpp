@@ -0,0 +1,101 @@
+#include "Debug/StageStats.h"
+#include "Misc/CoreDelegates.h"
+
+DEFINE_STAT(STAT_StageEntityStateChanges);
+DEFINE_STAT(STAT_StageActActivations);
+DEFINE_STAT(STAT_StageOverlapEvents);
+DEFINE_STAT(STAT_StagesUnloaded);
+DEFINE_STAT(STAT_StagesPreloading);
+DEFINE_STAT(STAT_StagesLoaded);
+DEFINE_STAT(STAT_StagesActive);
+DEFINE_STAT(STAT_StagesUnloading);
+DEFINE_STAT(STAT_StageDataLayerTransitionsInFlight);
+DEFINE_STAT(STAT_StageStateTransition);
+
+CSV_DEFINE_CATEGORY(Stage, true);
+
+int32 FStageStats::StageCountByState[5] = {};
+int32 FStageStats::DataLayerTransitionsInFlight = 0;
+FDelegateHandle FStageStats::EndFrameHandle;
+
+void FStageStats::Initialize()
+{
+#if CSV_PROFILER
+	if (!EndFrameHandle.IsValid())
+	{
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FStageStats::PublishCsvGauges);
+	}
+#endif
+}
+
+void FStageStats::Shutdown()
+{
+	if (EndFrameHandle.IsValid())
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+}
+
+void FStageStats::OnStageBeginPlay(EStageRuntimeState State)
+{
+	AdjustStateCount(State, 1);
+}
+
+void FStageStats::OnStageEndPlay(EStageRuntimeState State)
+{
+	AdjustStateCount(State, -1);
+}
+
+void FStageStats::OnStateTransition(EStageRuntimeState OldState, EStageRuntimeState NewState)
+{
+	AdjustStateCount(OldState, -1);
+	AdjustStateCount(NewState, 1);
+}
+
+void FStageStats::OnDataLayerTransitionBegin()
+{
+	++DataLayerTransitionsInFlight;
+	INC_DWORD_STAT(STAT_StageDataLayerTransitionsInFlight);
+}
+
+void FStageStats::OnDataLayerTransitionEnd()
+{
+	DataLayerTransitionsInFlight = FMath::Max(0, DataLayerTransitionsInFlight - 1);
+	SET_DWORD_STAT(STAT_StageDataLayerTransitionsInFlight, DataLayerTransitionsInFlight);
+}
+
+void FStageStats::AdjustStateCount(EStageRuntimeState State, int32 Delta)
+{
+	const int32 Index = (int32)State;
+	if (Index < 0 || Index >= UE_ARRAY_COUNT(StageCountByState))
+	{
+		return;
+	}
+
+	const int32 Count = StageCountByState[Index] = FMath::Max(0, StageCountByState[Index] + Delta);
+
+	switch (State)
+	{
+	case EStageRuntimeState::Unloaded:   SET_DWORD_STAT(STAT_StagesUnloaded, Count); break;
+	case EStageRuntimeState::Preloading: SET_DWORD_STAT(STAT_StagesPreloading, Count); break;
+	case EStageRuntimeState::Loaded:     SET_DWORD_STAT(STAT_StagesLoaded, Count); break;
+	case EStageRuntimeState::Active:     SET_DWORD_STAT(STAT_StagesActive, Count); break;
+	case EStageRuntimeState::Unloading:  SET_DWORD_STAT(STAT_StagesUnloading, Count); break;
+	default: break;
+	}
+
+	// Stats compiled out (e.g. Test builds) leave Count otherwise unused
+	(void)Count;
+}
+
+void FStageStats::PublishCsvGauges()
+{
+	// Gauges persist across frames, so they are re-emitted once per frame (no-op unless a capture is running)
+	CSV_CUSTOM_STAT(Stage, StagesUnloaded, StageCountByState[(int32)EStageRuntimeState::Unloaded], ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Stage, StagesPreloading, StageCountByState[(int32)EStageRuntimeState::Preloading], ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Stage, StagesLoaded, StageCountByState[(int32)EStageRuntimeState::Loaded], ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Stage, StagesActive, StageCountByState[(int32)EStageRuntimeState::Active], ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Stage, StagesUnloading, StageCountByState[(int32)EStageRuntimeState::Unloading], ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Stage, DataLayerTransitionsInFlight, DataLayerTransitionsInFlight, ECsvCustomStatOp::Set);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Core/StageCoreTypes.h"
+
+/**
+ * @brief "STAT Stage" counters and CSV profiler category for Stage runtime behaviour.
+ *
+ * - STAT Stage: per-frame event counters, Stage counts per runtime state, in-flight
+ *   DataLayer transitions and state transition time (stats builds only).
+ * - CSV: the same values under the "Stage" category. CSV profiling stays compiled in
+ *   Test builds, so soak-test captures (-csvCaptureFrames / CsvProfile Start) include them.
+ *
+ * Every hook is a counter increment or a scoped timer; nothing walks the Stage list.
+ */
+DECLARE_STATS_GROUP(TEXT("Stage"), STATGROUP_Stage, STATCAT_Advanced);
+
+// Per-frame event counters
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Entity State Changes"), STAT_StageEntityStateChanges, STATGROUP_Stage, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Act Activations"), STAT_StageActActivations, STATGROUP_Stage, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Overlap Events"), STAT_StageOverlapEvents, STATGROUP_Stage, );
+
+// Persistent gauges
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Stages Unloaded"), STAT_StagesUnloaded, STATGROUP_Stage, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Stages Preloading"), STAT_StagesPreloading, STATGROUP_Stage, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Stages Loaded"), STAT_StagesLoaded, STATGROUP_Stage, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Stages Active"), STAT_StagesActive, STATGROUP_Stage, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Stages Unloading"), STAT_StagesUnloading, STATGROUP_Stage, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("DataLayer Transitions In Flight"), STAT_StageDataLayerTransitionsInFlight, STATGROUP_Stage, );
+
+// Timing
+DECLARE_CYCLE_STAT_EXTERN(TEXT("State Transition"), STAT_StageStateTransition, STATGROUP_Stage, );
+
+CSV_DECLARE_CATEGORY_EXTERN(Stage);
+
+/**
+ * @brief Gauge bookkeeping behind the Stage stats.
+ * Game thread only. Counts are global across worlds, like engine stats.
+ */
+class FStageStats
+{
+public:
+	/** Binds the end-of-frame CSV gauge publisher (called by the runtime module). */
+	static void Initialize();
+
+	/** Unbinds the CSV gauge publisher. */
+	static void Shutdown();
+
+	/** A Stage began play in the given state. */
+	static void OnStageBeginPlay(EStageRuntimeState State);
+
+	/** A Stage ended play in the given state. */
+	static void OnStageEndPlay(EStageRuntimeState State);
+
+	/** A playing Stage moved between runtime states. */
+	static void OnStateTransition(EStageRuntimeState OldState, EStageRuntimeState NewState);
+
+	/** A Stage started / stopped waiting on its DataLayer. */
+	static void OnDataLayerTransitionBegin();
+	static void OnDataLayerTransitionEnd();
+
+private:
+	static void AdjustStateCount(EStageRuntimeState State, int32 Delta);
+	static void PublishCsvGauges();
+
+	static int32 StageCountByState[5];
+	static int32 DataLayerTransitionsInFlight;
+	static FDelegateHandle EndFrameHandle;
+};
+
+/** Counts a per-frame Stage event for STAT Stage and the CSV profiler. */
+#define STAGE_STAT_EVENT(StatName, Amount) \
+	do \
+	{ \
+		INC_DWORD_STAT_BY(STAT_Stage##StatName, Amount); \
+		CSV_CUSTOM_STAT(Stage, StatName, (int32)(Amount), ECsvCustomStatOp::Accumulate); \
+	} while (0)
+
+/** Times the enclosing scope as a Stage state transition. */
+#define STAGE_STAT_SCOPE_STATE_TRANSITION() \
+	SCOPE_CYCLE_COUNTER(STAT_StageStateTransition); \
+	CSV_SCOPED_TIMING_STAT(Stage, StateTransition)
@@ -0,0 +1,212 @@
+#include "Debug/StageTimelineRecorder.h"
+#include "Core/StageCoreTypes.h"
+#include "Components/StageTriggerZoneComponent.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+const TCHAR* FStageTimelineCapture::FileExtension = TEXT(".stagerec");
+
+int32 FStageTimelineRecorder::NumActiveRecorders = 0;
+
+//----------------------------------------------------------------
+// Capture
+//----------------------------------------------------------------
+
+void FStageTimelineCapture::Serialize(FArchive& Ar)
+{
+	Ar << WorldName;
+	Ar << StageNames;
+	Ar << Events;
+	Ar << FrameSamples;
+}
+
+bool FStageTimelineCapture::SaveToFile(const FString& Filename) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	Writer << Magic << Version;
+	const_cast<FStageTimelineCapture*>(this)->Serialize(Writer);
+
+	return FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+
+bool FStageTimelineCapture::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+	if (Magic != FileMagic || Version > FileVersion)
+	{
+		return false;
+	}
+
+	Serialize(Reader);
+	return !Reader.IsError();
+}
+
+const TCHAR* FStageTimelineCapture::GetEventTypeName(EStageTimelineEventType Type)
+{
+	switch (Type)
+	{
+	case EStageTimelineEventType::ZoneEnter:                return TEXT("ZoneEnter");
+	case EStageTimelineEventType::ZoneExit:                 return TEXT("ZoneExit");
+	case EStageTimelineEventType::StateChange:              return TEXT("StateChange");
+	case EStageTimelineEventType::ActActivated:             return TEXT("ActActivated");
+	case EStageTimelineEventType::ActDeactivated:           return TEXT("ActDeactivated");
+	case EStageTimelineEventType::ActDataLayerState:        return TEXT("ActDataLayerState");
+	case EStageTimelineEventType::DataLayerTransitionBegin: return TEXT("DataLayerWaitBegin");
+	case EStageTimelineEventType::DataLayerTransitionEnd:   return TEXT("DataLayerWaitEnd");
+	default:                                                return TEXT("Unknown");
+	}
+}
+
+FString FStageTimelineCapture::DescribeEvent(const FStageTimelineEvent& Event) const
+{
+	const FString* StageName = StageNames.Find(Event.StageID);
+	const FString StageLabel = StageName ? FString::Printf(TEXT("%s (%d)"), **StageName, Event.StageID)
+		: FString::Printf(TEXT("Stage %d"), Event.StageID);
+
+	auto StateName = [](uint8 Value) -> FString
+	{
+		const UEnum* Enum = StaticEnum<EStageRuntimeState>();
+		return Enum ? Enum->GetNameStringByValue(Value) : FString::FromInt(Value);
+	};
+
+	FString Details;
+	switch (Event.Type)
+	{
+	case EStageTimelineEventType::ZoneEnter:
+	case EStageTimelineEventType::ZoneExit:
+		Details = FString::Printf(TEXT("%s, %d overlapping"),
+			Event.ValueA == (uint8)EStageTriggerZoneType::LoadZone ? TEXT("LoadZone") : TEXT("ActivateZone"), Event.Param);
+		break;
+	case EStageTimelineEventType::StateChange:
+		Details = FString::Printf(TEXT("%s -> %s"), *StateName(Event.ValueA), *StateName(Event.ValueB));
+		break;
+	case EStageTimelineEventType::ActActivated:
+	case EStageTimelineEventType::ActDeactivated:
+		Details = FString::Printf(TEXT("Act %d"), Event.Param);
+		break;
+	case EStageTimelineEventType::ActDataLayerState:
+		Details = FString::Printf(TEXT("Act %d -> DL state %d%s"), Event.Param, Event.ValueA, Event.ValueB ? TEXT("") : TEXT(" (failed)"));
+		break;
+	case EStageTimelineEventType::DataLayerTransitionBegin:
+		Details = FString::Printf(TEXT("target DL state %d"), Event.ValueA);
+		break;
+	default:
+		break;
+	}
+
+	return FString::Printf(TEXT("[%8.3fs #%llu] %s %s %s"),
+		Event.Time, Event.Frame, *StageLabel, GetEventTypeName(Event.Type), *Details);
+}
+
+//----------------------------------------------------------------
+// Recorder
+//----------------------------------------------------------------
+
+FStageTimelineRecorder::~FStageTimelineRecorder()
+{
+	Stop();
+}
+
+void FStageTimelineRecorder::Start(int32 InEventCapacity, int32 InFrameCapacity)
+{
+	Stop();
+
+	EventBuffer.SetNumUninitialized(FMath::Max(1, InEventCapacity));
+	FrameBuffer.SetNumUninitialized(FMath::Max(1, InFrameCapacity));
+	EventHead = EventCount = 0;
+	FrameHead = FrameCount = 0;
+	DroppedEventCount = 0;
+
+	StartSeconds = FPlatformTime::Seconds();
+	bRecording = true;
+	++NumActiveRecorders;
+
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FStageTimelineRecorder::RecordFrameSample);
+}
+
+void FStageTimelineRecorder::Stop()
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	bRecording = false;
+	--NumActiveRecorders;
+}
+
+void FStageTimelineRecorder::Record(EStageTimelineEventType Type, int32 StageID, int32 Param, uint8 ValueA, uint8 ValueB)
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	FStageTimelineEvent& Event = EventBuffer[EventHead];
+	Event.Time = FPlatformTime::Seconds() - StartSeconds;
+	Event.Frame = GFrameCounter;
+	Event.StageID = StageID;
+	Event.Param = Param;
+	Event.Type = Type;
+	Event.ValueA = ValueA;
+	Event.ValueB = ValueB;
+
+	EventHead = (EventHead + 1) % EventBuffer.Num();
+	if (EventCount < EventBuffer.Num())
+	{
+		++EventCount;
+	}
+	else
+	{
+		++DroppedEventCount;
+	}
+}
+
+void FStageTimelineRecorder::RecordFrameSample()
+{
+	FStageTimelineFrameSample& Sample = FrameBuffer[FrameHead];
+	Sample.Time = FPlatformTime::Seconds() - StartSeconds;
+	Sample.Frame = GFrameCounter;
+	Sample.DeltaMs = (float)(FApp::GetDeltaTime() * 1000.0);
+
+	FrameHead = (FrameHead + 1) % FrameBuffer.Num();
+	FrameCount = FMath::Min(FrameCount + 1, FrameBuffer.Num());
+}
+
+void FStageTimelineRecorder::BuildCapture(FStageTimelineCapture& OutCapture) const
+{
+	// Oldest entry sits at Head once the ring has wrapped
+	OutCapture.Events.Reset(EventCount);
+	const int32 FirstEvent = EventCount < EventBuffer.Num() ? 0 : EventHead;
+	for (int32 Index = 0; Index < EventCount; ++Index)
+	{
+		OutCapture.Events.Add(EventBuffer[(FirstEvent + Index) % EventBuffer.Num()]);
+	}
+
+	OutCapture.FrameSamples.Reset(FrameCount);
+	const int32 FirstFrame = FrameCount < FrameBuffer.Num() ? 0 : FrameHead;
+	for (int32 Index = 0; Index < FrameCount; ++Index)
+	{
+		OutCapture.FrameSamples.Add(FrameBuffer[(FirstFrame + Index) % FrameBuffer.Num()]);
+	}
+}
@@ -0,0 +1,101 @@
+#include "Debug/StageTrace.h"
+
+#if STAGE_TRACE_ENABLED
+
+#include "HAL/PlatformTime.h"
+
+UE_TRACE_CHANNEL_DEFINE(StageChannel)
+
+//----------------------------------------------------------------
+// Event Definitions
+//----------------------------------------------------------------
+
+UE_TRACE_EVENT_BEGIN(Stage, StateChange)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, StageID)
+	UE_TRACE_EVENT_FIELD(uint8, OldState)
+	UE_TRACE_EVENT_FIELD(uint8, NewState)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Stage, ActActivated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, StageID)
+	UE_TRACE_EVENT_FIELD(int32, ActID)
+	UE_TRACE_EVENT_FIELD(int32, EntityCount)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Stage, ActEntityStatesApplied)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, StageID)
+	UE_TRACE_EVENT_FIELD(int32, ActID)
+	UE_TRACE_EVENT_FIELD(int32, EntityCount)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Stage, ActDataLayerState)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, StageID)
+	UE_TRACE_EVENT_FIELD(int32, ActID)
+	UE_TRACE_EVENT_FIELD(uint8, NewState)
+	UE_TRACE_EVENT_FIELD(bool, bSuccess)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Stage, ZoneOverlap)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(int32, StageID)
+	UE_TRACE_EVENT_FIELD(uint8, ZoneType)
+	UE_TRACE_EVENT_FIELD(bool, bBegin)
+	UE_TRACE_EVENT_FIELD(int32, OverlapCount)
+UE_TRACE_EVENT_END()
+
+//----------------------------------------------------------------
+// Event Output
+//----------------------------------------------------------------
+
+void FStageTrace::OutputStateChange(int32 StageID, uint8 OldState, uint8 NewState)
+{
+	UE_TRACE_LOG(Stage, StateChange, StageChannel)
+		<< StateChange.Cycle(FPlatformTime::Cycles64())
+		<< StateChange.StageID(StageID)
+		<< StateChange.OldState(OldState)
+		<< StateChange.NewState(NewState);
+}
+
+void FStageTrace::OutputActActivated(int32 StageID, int32 ActID, int32 EntityCount)
+{
+	UE_TRACE_LOG(Stage, ActActivated, StageChannel)
+		<< ActActivated.Cycle(FPlatformTime::Cycles64())
+		<< ActActivated.StageID(StageID)
+		<< ActActivated.ActID(ActID)
+		<< ActActivated.EntityCount(EntityCount);
+}
+
+void FStageTrace::OutputActEntityStatesApplied(int32 StageID, int32 ActID, int32 EntityCount)
+{
+	UE_TRACE_LOG(Stage, ActEntityStatesApplied, StageChannel)
+		<< ActEntityStatesApplied.Cycle(FPlatformTime::Cycles64())
+		<< ActEntityStatesApplied.StageID(StageID)
+		<< ActEntityStatesApplied.ActID(ActID)
+		<< ActEntityStatesApplied.EntityCount(EntityCount);
+}
+
+void FStageTrace::OutputActDataLayerState(int32 StageID, int32 ActID, uint8 NewState, bool bSuccess)
+{
+	UE_TRACE_LOG(Stage, ActDataLayerState, StageChannel)
+		<< ActDataLayerState.Cycle(FPlatformTime::Cycles64())
+		<< ActDataLayerState.StageID(StageID)
+		<< ActDataLayerState.ActID(ActID)
+		<< ActDataLayerState.NewState(NewState)
+		<< ActDataLayerState.bSuccess(bSuccess);
+}
+
+void FStageTrace::OutputZoneOverlap(int32 StageID, uint8 ZoneType, bool bBegin, int32 OverlapCount)
+{
+	UE_TRACE_LOG(Stage, ZoneOverlap, StageChannel)
+		<< ZoneOverlap.Cycle(FPlatformTime::Cycles64())
+		<< ZoneOverlap.StageID(StageID)
+		<< ZoneOverlap.ZoneType(ZoneType)
+		<< ZoneOverlap.bBegin(bBegin)
+		<< ZoneOverlap.OverlapCount(OverlapCount);
+}
+
+#endif // STAGE_TRACE_ENABLED
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * @brief Unreal Insights instrumentation for Stage runtime transitions.
+ *
+ * Enable with "-trace=cpu,stage" (or "Trace.Enable cpu,stage" at runtime).
+ * Scoped CPU events show up in the Timing view; the typed events below carry
+ * StageID/ActID/entity counts and can be inspected in the Log/Events views.
+ */
+#define STAGE_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if STAGE_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(StageChannel)
+
+struct FStageTrace
+{
+	static void OutputStateChange(int32 StageID, uint8 OldState, uint8 NewState);
+	static void OutputActActivated(int32 StageID, int32 ActID, int32 EntityCount);
+	static void OutputActEntityStatesApplied(int32 StageID, int32 ActID, int32 EntityCount);
+	static void OutputActDataLayerState(int32 StageID, int32 ActID, uint8 NewState, bool bSuccess);
+	static void OutputZoneOverlap(int32 StageID, uint8 ZoneType, bool bBegin, int32 OverlapCount);
+};
+
+/** Scoped CPU timing event on the Stage channel. */
+#define TRACE_STAGE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, StageChannel)
+
+#define TRACE_STAGE_STATE_CHANGE(StageID, OldState, NewState) \
+	FStageTrace::OutputStateChange(StageID, (uint8)(OldState), (uint8)(NewState))
+
+#define TRACE_STAGE_ACT_ACTIVATED(StageID, ActID, EntityCount) \
+	FStageTrace::OutputActActivated(StageID, ActID, EntityCount)
+
+#define TRACE_STAGE_ACT_ENTITY_STATES(StageID, ActID, EntityCount) \
+	FStageTrace::OutputActEntityStatesApplied(StageID, ActID, EntityCount)
+
+#define TRACE_STAGE_ACT_DATALAYER_STATE(StageID, ActID, NewState, bSuccess) \
+	FStageTrace::OutputActDataLayerState(StageID, ActID, (uint8)(NewState), bSuccess)
+
+#define TRACE_STAGE_ZONE_OVERLAP(StageID, ZoneType, bBegin, OverlapCount) \
+	FStageTrace::OutputZoneOverlap(StageID, (uint8)(ZoneType), bBegin, OverlapCount)
+
+#else
+
+#define TRACE_STAGE_SCOPE(Name)
+#define TRACE_STAGE_STATE_CHANGE(StageID, OldState, NewState)
+#define TRACE_STAGE_ACT_ACTIVATED(StageID, ActID, EntityCount)
+#define TRACE_STAGE_ACT_ENTITY_STATES(StageID, ActID, EntityCount)
+#define TRACE_STAGE_ACT_DATALAYER_STATE(StageID, ActID, NewState, bSuccess)
+#define TRACE_STAGE_ZONE_OVERLAP(StageID, ZoneType, bBegin, OverlapCount)
+
+#endif // STAGE_TRACE_ENABLED
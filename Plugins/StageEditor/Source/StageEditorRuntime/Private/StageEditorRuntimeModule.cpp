@@ -3,6 +3,8 @@
 #include "Debug/StageDebugSettings.h"
 #include "Subsystems/StageManagerSubsystem.h"
 #include "Actors/Stage.h"
+#include "Components/StageEntityRefreshQueue.h"
+#include "Debug/StageStats.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 
@@ -273,18 +275,77 @@ static FAutoConsoleCommand StageWatchListCommand(
 	})
 );
 
+/**
+ * Console command: Stage.Record <Start [EventCapacity]|Stop|Dump [Path]|Status>
+ * Records zone enters/exits, state transitions, Act and DataLayer events into a ring buffer
+ * and writes them to a .stagerec capture (open in the editor via Window > Stage Timeline).
+ */
+static FAutoConsoleCommand StageRecordCommand(
+	TEXT("Stage.Record"),
+	TEXT("Record Stage timeline events. Usage: Stage.Record Start [EventCapacity] | Stop | Dump [Path] | Status"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		UStageManagerSubsystem* Subsystem = GetStageManagerSubsystem();
+		if (!Subsystem)
+		{
+			PrintCommandFeedback(TEXT("Stage.Record: No game world active"), FColor::Red);
+			return;
+		}
+
+		FStageTimelineRecorder& Recorder = Subsystem->GetTimelineRecorder();
+		const FString Action = Args.Num() > 0 ? Args[0] : TEXT("Status");
+
+		if (Action.Equals(TEXT("Start"), ESearchCase::IgnoreCase))
+		{
+			const int32 Capacity = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : FStageTimelineRecorder::DefaultEventCapacity;
+			Recorder.Start(Capacity > 0 ? Capacity : FStageTimelineRecorder::DefaultEventCapacity);
+			PrintCommandFeedback(FString::Printf(TEXT("Stage.Record: Recording (capacity %d events)"), Recorder.GetEventCapacity()), FColor::Green);
+		}
+		else if (Action.Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+		{
+			Recorder.Stop();
+			PrintCommandFeedback(FString::Printf(TEXT("Stage.Record: Stopped (%d events). Use Stage.Record Dump to save."), Recorder.GetEventCount()), FColor::Yellow);
+		}
+		else if (Action.Equals(TEXT("Dump"), ESearchCase::IgnoreCase))
+		{
+			const FString Path = Subsystem->DumpTimeline(Args.Num() > 1 ? Args[1] : FString());
+			if (Path.IsEmpty())
+			{
+				PrintCommandFeedback(TEXT("Stage.Record: Dump failed"), FColor::Red);
+			}
+			else
+			{
+				PrintCommandFeedback(FString::Printf(TEXT("Stage.Record: Wrote %s"), *Path), FColor::Green);
+			}
+		}
+		else
+		{
+			PrintCommandFeedback(FString::Printf(TEXT("Stage.Record: %s, %d/%d events (%lld dropped), %d frame samples"),
+				Recorder.IsRecording() ? TEXT("recording") : TEXT("idle"),
+				Recorder.GetEventCount(), Recorder.GetEventCapacity(),
+				Recorder.GetDroppedEventCount(), Recorder.GetFrameSampleCount()), FColor::Cyan);
+		}
+	})
+);
+
 #pragma endregion Console Commands
 
 #pragma region Module Interface
 void FStageEditorRuntimeModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	FStageStats::Initialize();
 }
 
 void FStageEditorRuntimeModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FStageStats::Shutdown();
+
+#if WITH_EDITOR
+	FStageEntityRefreshQueue::Get().Shutdown();
+#endif
 }
 #pragma endregion Module Interface
 
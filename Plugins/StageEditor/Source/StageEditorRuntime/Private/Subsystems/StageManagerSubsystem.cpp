@@ -1,7 +1,13 @@
 #pragma region Imports
 #include "Subsystems/StageManagerSubsystem.h"
 #include "Actors/Stage.h"
+#include "Components/StageTriggerZoneComponent.h"
+#include "Core/StageStreamingSettings.h"
 #include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/Paths.h"
+#include "TimerManager.h"
 #include "WorldPartition/DataLayer/DataLayerAsset.h"
 #pragma endregion Imports
 
@@ -28,10 +34,30 @@ void UStageManagerSubsystem::Deinitialize()
 	// Release all overrides before clearing registry
 	ReleaseAllStageOverrides();
 
+	TimelineRecorder.Stop();
+
 	UE_LOG(LogStageManager, Log, TEXT("StageManagerSubsystem deinitialized. Total registered Stages: %d"), StageRegistry.Num());
 
 	StageRegistry.Empty();
 	OverriddenStageStates.Empty();
+	DataLayerOwnerIndex.Empty();
+	IndexedDataLayersByStageID.Empty();
+
+	// Drop any queued streaming work
+	PendingLoadRequests.Empty();
+	InFlightLoads.Empty();
+	PendingActivationRequests.Empty();
+	ProximityGrid.Empty();
+	OversizedProximityZones.Empty();
+	ProximityZoneBounds.Empty();
+	StreamingSources.Empty();
+	ProximityInsidePairs.Empty();
+	PredictedStageHitTimes.Empty();
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+	bStreamingQueueScheduled = false;
 
 	Super::Deinitialize();
 }
@@ -54,6 +80,29 @@ bool UStageManagerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 	       WorldType == EWorldType::GamePreview;
 }
 
+void UStageManagerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (IsProximityStreamingActive())
+	{
+		const float Interval = 1.0f / FMath::Max(UStageStreamingSettings::Get()->ProximityUpdateRate, 1.0f);
+		InWorld.GetTimerManager().SetTimer(ProximityTimerHandle, this, &UStageManagerSubsystem::UpdateProximityStreaming, Interval, true);
+
+		UE_LOG(LogStageManager, Log, TEXT("StageManagerSubsystem: Proximity streaming enabled (%.1f Hz, %d zones)"),
+			1.0f / Interval, ProximityZoneBounds.Num());
+	}
+
+	if (IsPredictivePreloadActive())
+	{
+		const float Interval = 1.0f / FMath::Max(UStageStreamingSettings::Get()->PredictiveUpdateRate, 1.0f);
+		InWorld.GetTimerManager().SetTimer(PredictiveTimerHandle, this, &UStageManagerSubsystem::UpdatePredictivePreload, Interval, true);
+
+		UE_LOG(LogStageManager, Log, TEXT("StageManagerSubsystem: Predictive preload enabled (%.1f Hz, lookahead %.1fs)"),
+			1.0f / Interval, UStageStreamingSettings::Get()->PredictiveLookaheadTime);
+	}
+}
+
 #pragma endregion Lifecycle
 
 #pragma region Stage Registration API
@@ -136,6 +185,8 @@ int32 UStageManagerSubsystem::RegisterStage(AStage* Stage)
 	// Broadcast delegate for Editor module to invalidate cache
 	if (ResultStageID > 0)
 	{
+		RemoveStageFromDataLayerIndex(ResultStageID);
+		IndexStageDataLayers(ResultStageID, Stage);
 		OnStageRegistered.Broadcast(Stage);
 	}
 
@@ -159,6 +210,7 @@ void UStageManagerSubsystem::UnregisterStage(int32 StageID)
 
 	// Remove any override tracking for this Stage
 	OverriddenStageStates.Remove(StageID);
+	RemoveStageFromDataLayerIndex(StageID);
 
 	if (StageRegistry.Remove(StageID) > 0)
 	{
@@ -177,6 +229,16 @@ void UStageManagerSubsystem::UnregisterStage(int32 StageID)
 
 void UStageManagerSubsystem::BroadcastStageDataChanged(AStage* Stage)
 {
+	// Import/Sync may have reassigned DataLayers directly
+	if (Stage)
+	{
+		RefreshStageDataLayerIndex(Stage);
+	}
+	else
+	{
+		RebuildDataLayerIndex();
+	}
+
 	OnStageDataChanged.Broadcast(Stage);
 }
 
@@ -258,6 +320,7 @@ void UStageManagerSubsystem::CleanupRegistry()
 	for (int32 ID : InvalidIDs)
 	{
 		StageRegistry.Remove(ID);
+		RemoveStageFromDataLayerIndex(ID);
 		UE_LOG(LogStageManager, Verbose, TEXT("StageManagerSubsystem: Cleaned up invalid Stage ID: %d"), ID);
 	}
 
@@ -324,6 +387,8 @@ void UStageManagerSubsystem::ScanWorldForExistingStages()
 		NextStageID = MaxExistingID + 1;
 	}
 
+	RebuildDataLayerIndex();
+
 	if (InvalidCount > 0)
 	{
 		UE_LOG(LogStageManager, Error, TEXT("StageManagerSubsystem: Found %d Stage(s) with invalid ID! See errors above."), InvalidCount);
@@ -333,6 +398,371 @@ void UStageManagerSubsystem::ScanWorldForExistingStages()
 		FoundCount, InvalidCount, EditorWatchedCount, NextStageID);
 }
 
+bool UStageManagerSubsystem::IsStreamingSchedulerActive() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->IsGameWorld() && UStageStreamingSettings::Get()->bEnableStreamingScheduler;
+}
+
+void UStageManagerSubsystem::ScheduleStreamingQueue()
+{
+	if (bStreamingQueueScheduled)
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		bStreamingQueueScheduled = true;
+		World->GetTimerManager().SetTimerForNextTick(this, &UStageManagerSubsystem::ProcessStreamingQueue);
+	}
+}
+
+void UStageManagerSubsystem::ProcessStreamingQueue()
+{
+	bStreamingQueueScheduled = false;
+
+	const UStageStreamingSettings* Settings = UStageStreamingSettings::Get();
+
+	// Drop requests for destroyed Stages
+	auto IsStale = [](const FStageStreamingRequest& Request) { return !Request.Stage.IsValid(); };
+	PendingLoadRequests.RemoveAll(IsStale);
+	PendingActivationRequests.RemoveAll(IsStale);
+	for (auto It = InFlightLoads.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// 1. Loads: fill free slots, highest priority / nearest first
+	if (PendingLoadRequests.Num() > 0 && InFlightLoads.Num() < Settings->MaxConcurrentStageLoads)
+	{
+		SortStreamingRequests(PendingLoadRequests);
+
+		while (PendingLoadRequests.Num() > 0 && InFlightLoads.Num() < Settings->MaxConcurrentStageLoads)
+		{
+			AStage* Stage = PendingLoadRequests[0].Stage.Get();
+			PendingLoadRequests.RemoveAt(0, EAllowShrinking::No);
+
+			UE_LOG(LogStageManager, Verbose, TEXT("StreamingScheduler: Starting load for Stage '%s' (pending: %d)"),
+				*Stage->GetName(), PendingLoadRequests.Num());
+
+			// May complete synchronously, in which case ReleaseStageLoad removes it again
+			InFlightLoads.Add(Stage);
+			Stage->StartScheduledStageLoad();
+		}
+	}
+
+	// 2. Activations: at most MaxStageActivationsPerFrame this tick
+	if (PendingActivationRequests.Num() > 0)
+	{
+		SortStreamingRequests(PendingActivationRequests);
+
+		const int32 Budget = FMath::Min(Settings->MaxStageActivationsPerFrame, PendingActivationRequests.Num());
+		TArray<FStageStreamingRequest> Granted(PendingActivationRequests.GetData(), Budget);
+		PendingActivationRequests.RemoveAt(0, Budget, EAllowShrinking::No);
+
+		for (const FStageStreamingRequest& Request : Granted)
+		{
+			if (AStage* Stage = Request.Stage.Get())
+			{
+				Stage->StartScheduledStageActivation();
+			}
+		}
+	}
+
+	// Continue next frame while work remains
+	if (PendingActivationRequests.Num() > 0 ||
+		(PendingLoadRequests.Num() > 0 && InFlightLoads.Num() < Settings->MaxConcurrentStageLoads))
+	{
+		ScheduleStreamingQueue();
+	}
+}
+
+void UStageManagerSubsystem::GatherStreamingSources(TArray<AActor*, TInlineAllocator<8>>& OutSources)
+{
+	for (auto It = StreamingSources.CreateIterator(); It; ++It)
+	{
+		if (AActor* Source = It->Get())
+		{
+			OutSources.AddUnique(Source);
+		}
+		else
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (World && UStageStreamingSettings::Get()->bTrackPlayerPawns)
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (const APlayerController* PC = It->Get())
+			{
+				if (APawn* Pawn = PC->GetPawn())
+				{
+					OutSources.AddUnique(Pawn);
+				}
+			}
+		}
+	}
+}
+
+void UStageManagerSubsystem::UpdatePredictivePreload()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const UStageStreamingSettings* Settings = UStageStreamingSettings::Get();
+	const double Now = World->GetTimeSeconds();
+	const float Lookahead = Settings->PredictiveLookaheadTime;
+	const float MinSpeedSq = FMath::Square(Settings->PredictiveMinSpeed);
+
+	TArray<AActor*, TInlineAllocator<8>> Sources;
+	GatherStreamingSources(Sources);
+
+	// 1. Extrapolate moving sources and test the predicted path against LoadZones
+	for (AActor* Source : Sources)
+	{
+		const FVector Velocity = Source->GetVelocity();
+		if (Velocity.SizeSquared() < MinSpeedSq)
+		{
+			continue;
+		}
+
+		const FVector Start = Source->GetActorLocation();
+		const FVector End = Start + Velocity * Lookahead;
+
+		// Candidate LoadZones: grid cells under the predicted path, plus oversized zones
+		TArray<UStageTriggerZoneComponent*, TInlineAllocator<16>> CandidateZones;
+		auto AddCandidate = [&CandidateZones](const TWeakObjectPtr<UStageTriggerZoneComponent>& ZonePtr)
+		{
+			UStageTriggerZoneComponent* Zone = ZonePtr.Get();
+			if (Zone && Zone->ZoneType == EStageTriggerZoneType::LoadZone)
+			{
+				CandidateZones.AddUnique(Zone);
+			}
+		};
+
+		FIntPoint CellMin, CellMax;
+		GetProximityCellRange(FBox(Start.ComponentMin(End), Start.ComponentMax(End)), CellMin, CellMax);
+		const int64 CellCount = int64(CellMax.X - CellMin.X + 1) * int64(CellMax.Y - CellMin.Y + 1);
+		if (CellCount > MaxProximityCellsPerQuery)
+		{
+			// Path spans more cells than there are worth probing; every hashed zone is cheaper
+			for (const TPair<TWeakObjectPtr<UStageTriggerZoneComponent>, FBox>& Pair : ProximityZoneBounds)
+			{
+				AddCandidate(Pair.Key);
+			}
+		}
+		else
+		{
+			for (int32 X = CellMin.X; X <= CellMax.X; ++X)
+			{
+				for (int32 Y = CellMin.Y; Y <= CellMax.Y; ++Y)
+				{
+					if (const TArray<TWeakObjectPtr<UStageTriggerZoneComponent>>* CellZones = ProximityGrid.Find(FIntPoint(X, Y)))
+					{
+						for (const TWeakObjectPtr<UStageTriggerZoneComponent>& Zone : *CellZones)
+						{
+							AddCandidate(Zone);
+						}
+					}
+				}
+			}
+			for (const TWeakObjectPtr<UStageTriggerZoneComponent>& Zone : OversizedProximityZones)
+			{
+				AddCandidate(Zone);
+			}
+		}
+
+		TArray<AStage*, TInlineAllocator<8>> HitStages;
+		for (const UStageTriggerZoneComponent* Zone : CandidateZones)
+		{
+			AStage* Stage = Zone->GetBoundStage();
+			if (!Stage || HitStages.Contains(Stage))
+			{
+				continue;
+			}
+
+			// Only Unloaded Stages can start, and predicted Stages need their prediction refreshed
+			const bool bUnloaded = Stage->GetCurrentStageState() == EStageRuntimeState::Unloaded;
+			if (!bUnloaded && !Stage->IsPredictivePreload())
+			{
+				continue;
+			}
+
+			if (!Zone->IsZoneEnabled() || !Zone->ShouldTriggerForActor(Source) ||
+				!Zone->DoesSegmentIntersectZone(Start, End))
+			{
+				continue;
+			}
+
+			HitStages.Add(Stage);
+			if (bUnloaded && Stage->RequestPredictivePreload(Source))
+			{
+				RecordStageLoadTrigger(true);
+				UE_LOG(LogStageManager, Verbose, TEXT("PredictivePreload: Stage '%s' preloading for '%s' (speed %.0f)"),
+					*Stage->GetName(), *Source->GetName(), Velocity.Size());
+			}
+			PredictedStageHitTimes.Add(Stage, Now);
+		}
+	}
+
+	// 2. Expire predictions that stopped holding (source turned away or slowed down)
+	for (auto It = PredictedStageHitTimes.CreateIterator(); It; ++It)
+	{
+		AStage* Stage = It->Key.Get();
+		if (!Stage || !Stage->IsPredictivePreload())
+		{
+			// Realized (someone entered the LoadZone) or cancelled
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (Now - It->Value > Lookahead)
+		{
+			ExpiredPredictiveLoadCount++;
+			UE_LOG(LogStageManager, Verbose, TEXT("PredictivePreload: Stage '%s' prediction expired"), *Stage->GetName());
+			Stage->ExpirePredictivePreload();
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UStageManagerSubsystem::GetProximityCellRange(const FBox& Bounds, FIntPoint& OutMin, FIntPoint& OutMax) const
+{
+	OutMin = FIntPoint(FMath::FloorToInt32(Bounds.Min.X / ProximityCellSize), FMath::FloorToInt32(Bounds.Min.Y / ProximityCellSize));
+	OutMax = FIntPoint(FMath::FloorToInt32(Bounds.Max.X / ProximityCellSize), FMath::FloorToInt32(Bounds.Max.Y / ProximityCellSize));
+}
+
+void UStageManagerSubsystem::UpdateProximityStreaming()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// 1. Gather sources: explicit + player pawns
+	TArray<AActor*, TInlineAllocator<8>> Sources;
+	GatherStreamingSources(Sources);
+
+	// 2. Point-in-zone tests against the source's cell (plus oversized zones)
+	using FZoneSourcePair = TPair<TWeakObjectPtr<UStageTriggerZoneComponent>, TWeakObjectPtr<AActor>>;
+	TSet<FZoneSourcePair> InsidePairs;
+	InsidePairs.Reserve(ProximityInsidePairs.Num());
+
+	auto TestZone = [&InsidePairs](const TWeakObjectPtr<UStageTriggerZoneComponent>& ZonePtr, AActor* Source, const FVector& Location)
+	{
+		const UStageTriggerZoneComponent* Zone = ZonePtr.Get();
+		if (Zone && Zone->IsZoneEnabled() && Zone->IsPointInZone(Location))
+		{
+			InsidePairs.Add(FZoneSourcePair(ZonePtr, Source));
+		}
+	};
+
+	for (AActor* Source : Sources)
+	{
+		const FVector Location = Source->GetActorLocation();
+		const FIntPoint Cell(FMath::FloorToInt32(Location.X / ProximityCellSize), FMath::FloorToInt32(Location.Y / ProximityCellSize));
+
+		if (const TArray<TWeakObjectPtr<UStageTriggerZoneComponent>>* CellZones = ProximityGrid.Find(Cell))
+		{
+			for (const TWeakObjectPtr<UStageTriggerZoneComponent>& Zone : *CellZones)
+			{
+				TestZone(Zone, Source, Location);
+			}
+		}
+		for (const TWeakObjectPtr<UStageTriggerZoneComponent>& Zone : OversizedProximityZones)
+		{
+			TestZone(Zone, Source, Location);
+		}
+	}
+
+	// 3. Diff against last update. Exits first (ActivateZone before LoadZone),
+	//    then enters (LoadZone before ActivateZone), matching nested-box overlap order.
+	TArray<FZoneSourcePair> Exits;
+	TArray<FZoneSourcePair> Enters;
+	for (const FZoneSourcePair& Pair : ProximityInsidePairs)
+	{
+		if (!InsidePairs.Contains(Pair))
+		{
+			Exits.Add(Pair);
+		}
+	}
+	for (const FZoneSourcePair& Pair : InsidePairs)
+	{
+		if (!ProximityInsidePairs.Contains(Pair))
+		{
+			Enters.Add(Pair);
+		}
+	}
+
+	ProximityInsidePairs = MoveTemp(InsidePairs);
+
+	auto IsLoadZone = [](const FZoneSourcePair& Pair)
+	{
+		const UStageTriggerZoneComponent* Zone = Pair.Key.Get();
+		return Zone && Zone->ZoneType == EStageTriggerZoneType::LoadZone;
+	};
+	Exits.StableSort([&IsLoadZone](const FZoneSourcePair& A, const FZoneSourcePair& B) { return !IsLoadZone(A) && IsLoadZone(B); });
+	Enters.StableSort([&IsLoadZone](const FZoneSourcePair& A, const FZoneSourcePair& B) { return IsLoadZone(A) && !IsLoadZone(B); });
+
+	for (const FZoneSourcePair& Pair : Exits)
+	{
+		UStageTriggerZoneComponent* Zone = Pair.Key.Get();
+		AActor* Source = Pair.Value.Get();
+		if (Zone && Source)
+		{
+			Zone->NotifyActorExit(Source);
+		}
+	}
+	for (const FZoneSourcePair& Pair : Enters)
+	{
+		UStageTriggerZoneComponent* Zone = Pair.Key.Get();
+		AActor* Source = Pair.Value.Get();
+		if (Zone && Source)
+		{
+			Zone->NotifyActorEnter(Source);
+		}
+	}
+}
+
+void UStageManagerSubsystem::SortStreamingRequests(TArray<FStageStreamingRequest>& Requests) const
+{
+	// Fallback reference point when a request has no instigator
+	const APawn* PlayerPawn = nullptr;
+	if (const UWorld* World = GetWorld())
+	{
+		if (const APlayerController* PC = World->GetFirstPlayerController())
+		{
+			PlayerPawn = PC->GetPawn();
+		}
+	}
+
+	auto DistanceSq = [PlayerPawn](const FStageStreamingRequest& Request)
+	{
+		const AActor* Reference = Request.Instigator.IsValid() ? Request.Instigator.Get() : PlayerPawn;
+		return Reference ? FVector::DistSquared(Reference->GetActorLocation(), Request.Stage->GetActorLocation()) : 0.0;
+	};
+
+	Requests.StableSort([&DistanceSq](const FStageStreamingRequest& A, const FStageStreamingRequest& B)
+	{
+		if (A.Stage->StreamingPriority != B.Stage->StreamingPriority)
+		{
+			return A.Stage->StreamingPriority > B.Stage->StreamingPriority;
+		}
+		return DistanceSq(A) < DistanceSq(B);
+	});
+}
+
 #pragma endregion Internal Methods
 
 #pragma region Cross-Stage Communication API
@@ -454,41 +884,268 @@ void UStageManagerSubsystem::ReleaseAllStageOverrides()
 
 #pragma endregion Cross-Stage Communication API
 
-#pragma region DataLayer Sync API
+#pragma region Streaming Scheduler API
 
-AStage* UStageManagerSubsystem::FindStageByDataLayer(UDataLayerAsset* DataLayerAsset) const
+void UStageManagerSubsystem::RequestStageLoad(AStage* Stage, AActor* Instigator)
 {
-	if (!DataLayerAsset)
+	if (!Stage)
 	{
-		return nullptr;
+		return;
 	}
 
-	// Iterate through all registered Stages
-	for (const TPair<int32, TWeakObjectPtr<AStage>>& Pair : StageRegistry)
+	if (!IsStreamingSchedulerActive())
+	{
+		Stage->StartScheduledStageLoad();
+		return;
+	}
+
+	// Already queued or streaming - just refresh the instigator
+	if (InFlightLoads.Contains(Stage))
+	{
+		return;
+	}
+	for (FStageStreamingRequest& Request : PendingLoadRequests)
 	{
-		AStage* Stage = Pair.Value.Get();
-		if (!Stage)
+		if (Request.Stage == Stage)
 		{
-			continue;
+			Request.Instigator = Instigator;
+			return;
 		}
+	}
+
+	PendingLoadRequests.Add({ Stage, Instigator });
 
-		// Check Stage-level DataLayer
-		if (Stage->StageDataLayerAsset == DataLayerAsset)
+	UE_LOG(LogStageManager, Verbose, TEXT("StreamingScheduler: Queued load for Stage '%s' (pending: %d, in flight: %d)"),
+		*Stage->GetName(), PendingLoadRequests.Num(), InFlightLoads.Num());
+
+	ScheduleStreamingQueue();
+}
+
+void UStageManagerSubsystem::ReleaseStageLoad(AStage* Stage)
+{
+	if (!Stage)
+	{
+		return;
+	}
+
+	PendingLoadRequests.RemoveAll([Stage](const FStageStreamingRequest& Request)
+	{
+		return Request.Stage == Stage;
+	});
+
+	// A freed slot lets the next queued Stage start
+	if (InFlightLoads.Remove(Stage) > 0 && PendingLoadRequests.Num() > 0)
+	{
+		ScheduleStreamingQueue();
+	}
+}
+
+void UStageManagerSubsystem::RequestStageActivation(AStage* Stage, AActor* Instigator)
+{
+	if (!Stage)
+	{
+		return;
+	}
+
+	if (!IsStreamingSchedulerActive())
+	{
+		Stage->StartScheduledStageActivation();
+		return;
+	}
+
+	for (FStageStreamingRequest& Request : PendingActivationRequests)
+	{
+		if (Request.Stage == Stage)
 		{
-			return Stage;
+			Request.Instigator = Instigator;
+			return;
 		}
+	}
 
-		// Check Act-level DataLayers
-		for (const FAct& Act : Stage->Acts)
+	PendingActivationRequests.Add({ Stage, Instigator });
+	ScheduleStreamingQueue();
+}
+
+void UStageManagerSubsystem::CancelStageActivation(AStage* Stage)
+{
+	PendingActivationRequests.RemoveAll([Stage](const FStageStreamingRequest& Request)
+	{
+		return Request.Stage == Stage;
+	});
+}
+
+#pragma endregion Streaming Scheduler API
+
+#pragma region Proximity Streaming API
+
+bool UStageManagerSubsystem::IsProximityStreamingActive() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->IsGameWorld() && UStageStreamingSettings::Get()->bEnableProximityStreaming;
+}
+
+void UStageManagerSubsystem::RegisterProximityZone(UStageTriggerZoneComponent* Zone)
+{
+	if (!Zone)
+	{
+		return;
+	}
+
+	UnregisterProximityZone(Zone);
+
+	// The grid is built with the cell size in effect when the first zone registers
+	if (ProximityZoneBounds.Num() == 0)
+	{
+		ProximityCellSize = FMath::Max(UStageStreamingSettings::Get()->ProximityCellSize, 100.0f);
+	}
+
+	// Proximity replaces physics overlaps for this zone - take it out of the broadphase
+	if (IsProximityStreamingActive())
+	{
+		Zone->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Zone->SetGenerateOverlapEvents(false);
+	}
+
+	const FBox Bounds = Zone->Bounds.GetBox();
+	ProximityZoneBounds.Add(Zone, Bounds);
+
+	FIntPoint CellMin, CellMax;
+	GetProximityCellRange(Bounds, CellMin, CellMax);
+
+	// Very large zones would touch too many cells; test them against every source instead
+	const int64 CellCount = int64(CellMax.X - CellMin.X + 1) * int64(CellMax.Y - CellMin.Y + 1);
+	if (CellCount > MaxProximityCellsPerQuery)
+	{
+		OversizedProximityZones.Add(Zone);
+		return;
+	}
+
+	for (int32 X = CellMin.X; X <= CellMax.X; ++X)
+	{
+		for (int32 Y = CellMin.Y; Y <= CellMax.Y; ++Y)
 		{
-			if (Act.AssociatedDataLayer == DataLayerAsset)
+			ProximityGrid.FindOrAdd(FIntPoint(X, Y)).Add(Zone);
+		}
+	}
+}
+
+void UStageManagerSubsystem::UnregisterProximityZone(UStageTriggerZoneComponent* Zone)
+{
+	FBox Bounds;
+	if (!Zone || !ProximityZoneBounds.RemoveAndCopyValue(Zone, Bounds))
+	{
+		return;
+	}
+
+	if (OversizedProximityZones.Remove(Zone) == 0)
+	{
+		FIntPoint CellMin, CellMax;
+		GetProximityCellRange(Bounds, CellMin, CellMax);
+		for (int32 X = CellMin.X; X <= CellMax.X; ++X)
+		{
+			for (int32 Y = CellMin.Y; Y <= CellMax.Y; ++Y)
+			{
+				if (TArray<TWeakObjectPtr<UStageTriggerZoneComponent>>* Cell = ProximityGrid.Find(FIntPoint(X, Y)))
+				{
+					Cell->RemoveSingleSwap(Zone);
+					if (Cell->Num() == 0)
+					{
+						ProximityGrid.Remove(FIntPoint(X, Y));
+					}
+				}
+			}
+		}
+	}
+
+	// Forget inside-state without firing exits (the zone is going away)
+	for (auto It = ProximityInsidePairs.CreateIterator(); It; ++It)
+	{
+		if (It->Key == Zone)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UStageManagerSubsystem::RegisterStreamingSource(AActor* Source)
+{
+	if (Source)
+	{
+		StreamingSources.Add(Source);
+	}
+}
+
+void UStageManagerSubsystem::UnregisterStreamingSource(AActor* Source)
+{
+	if (!Source || StreamingSources.Remove(Source) == 0)
+	{
+		return;
+	}
+
+	// Player pawns are still tracked implicitly; the next update re-enters them if needed
+	for (auto It = ProximityInsidePairs.CreateIterator(); It; ++It)
+	{
+		if (It->Value == Source)
+		{
+			if (UStageTriggerZoneComponent* Zone = It->Key.Get())
 			{
-				return Stage;
+				Zone->NotifyActorExit(Source);
 			}
+			It.RemoveCurrent();
 		}
 	}
+}
 
-	return nullptr;
+#pragma endregion Proximity Streaming API
+
+#pragma region Predictive Preload API
+
+bool UStageManagerSubsystem::IsPredictivePreloadActive() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->IsGameWorld() && UStageStreamingSettings::Get()->bEnablePredictivePreload;
+}
+
+void UStageManagerSubsystem::RecordStageLoadTrigger(bool bPredicted)
+{
+	if (bPredicted)
+	{
+		PredictedStageLoadCount++;
+	}
+	else
+	{
+		ReactiveStageLoadCount++;
+	}
+}
+
+void UStageManagerSubsystem::ResetStreamingStats()
+{
+	PredictedStageLoadCount = 0;
+	ReactiveStageLoadCount = 0;
+	ExpiredPredictiveLoadCount = 0;
+	AvoidedUnloadCount = 0;
+}
+
+#pragma endregion Predictive Preload API
+
+#pragma region DataLayer Sync API
+
+AStage* UStageManagerSubsystem::FindStageByDataLayer(UDataLayerAsset* DataLayerAsset) const
+{
+	if (!DataLayerAsset)
+	{
+		return nullptr;
+	}
+
+	const FStageDataLayerOwner* Owner = DataLayerOwnerIndex.Find(DataLayerAsset);
+	if (Owner && !IsDataLayerOwnerValid(DataLayerAsset, *Owner))
+	{
+		// Stage data was edited without a refresh - rebuild once and retry
+		RebuildDataLayerIndex();
+		Owner = DataLayerOwnerIndex.Find(DataLayerAsset);
+	}
+
+	return Owner ? GetStage(Owner->StageID) : nullptr;
 }
 
 bool UStageManagerSubsystem::IsDataLayerImported(UDataLayerAsset* DataLayerAsset) const
@@ -503,15 +1160,110 @@ int32 UStageManagerSubsystem::FindActIDByDataLayer(AStage* Stage, UDataLayerAsse
 		return INDEX_NONE;
 	}
 
+	// Stages outside the registry (e.g. not yet registered) are not indexed
+	if (GetStage(Stage->GetStageID()) != Stage)
+	{
+		for (const FAct& Act : Stage->Acts)
+		{
+			if (Act.AssociatedDataLayer == DataLayerAsset)
+			{
+				return Act.SUID.ActID;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	if (FindStageByDataLayer(DataLayerAsset) != Stage)
+	{
+		return INDEX_NONE;
+	}
+
+	// FindStageByDataLayer validated the entry
+	return DataLayerOwnerIndex.FindChecked(DataLayerAsset).ActID;
+}
+
+void UStageManagerSubsystem::RefreshStageDataLayerIndex(AStage* Stage)
+{
+	if (!Stage || GetStage(Stage->GetStageID()) != Stage)
+	{
+		return;
+	}
+
+	RemoveStageFromDataLayerIndex(Stage->GetStageID());
+	IndexStageDataLayers(Stage->GetStageID(), Stage);
+}
+
+void UStageManagerSubsystem::IndexStageDataLayers(int32 StageID, AStage* Stage) const
+{
+	if (!Stage)
+	{
+		return;
+	}
+
+	TArray<TObjectKey<UDataLayerAsset>>& Indexed = IndexedDataLayersByStageID.FindOrAdd(StageID);
+
+	auto AddEntry = [this, StageID, &Indexed](UDataLayerAsset* Asset, int32 ActID)
+	{
+		if (!Asset || DataLayerOwnerIndex.Contains(Asset))
+		{
+			// First owner wins, matching the previous registry scan order
+			return;
+		}
+		DataLayerOwnerIndex.Add(Asset, { StageID, ActID });
+		Indexed.Add(Asset);
+	};
+
+	AddEntry(Stage->StageDataLayerAsset, INDEX_NONE);
 	for (const FAct& Act : Stage->Acts)
 	{
-		if (Act.AssociatedDataLayer == DataLayerAsset)
+		AddEntry(Act.AssociatedDataLayer, Act.SUID.ActID);
+	}
+}
+
+void UStageManagerSubsystem::RemoveStageFromDataLayerIndex(int32 StageID) const
+{
+	TArray<TObjectKey<UDataLayerAsset>> Indexed;
+	if (!IndexedDataLayersByStageID.RemoveAndCopyValue(StageID, Indexed))
+	{
+		return;
+	}
+
+	for (const TObjectKey<UDataLayerAsset>& Key : Indexed)
+	{
+		const FStageDataLayerOwner* Owner = DataLayerOwnerIndex.Find(Key);
+		if (Owner && Owner->StageID == StageID)
 		{
-			return Act.SUID.ActID;
+			DataLayerOwnerIndex.Remove(Key);
 		}
 	}
+}
+
+void UStageManagerSubsystem::RebuildDataLayerIndex() const
+{
+	DataLayerOwnerIndex.Reset();
+	IndexedDataLayersByStageID.Reset();
+
+	for (const TPair<int32, TWeakObjectPtr<AStage>>& Pair : StageRegistry)
+	{
+		IndexStageDataLayers(Pair.Key, Pair.Value.Get());
+	}
+}
+
+bool UStageManagerSubsystem::IsDataLayerOwnerValid(const UDataLayerAsset* DataLayerAsset, const FStageDataLayerOwner& Owner) const
+{
+	const AStage* Stage = GetStage(Owner.StageID);
+	if (!Stage)
+	{
+		return false;
+	}
 
-	return INDEX_NONE;
+	if (Owner.ActID == INDEX_NONE)
+	{
+		return Stage->StageDataLayerAsset == DataLayerAsset;
+	}
+
+	const FAct* Act = Stage->FindActByID(Owner.ActID);
+	return Act && Act->AssociatedDataLayer == DataLayerAsset;
 }
 
 #pragma endregion DataLayer Sync API
@@ -629,3 +1381,39 @@ TArray<int32> UStageManagerSubsystem::GetWatchedStageIDs() const
 }
 
 #pragma endregion Debug Watch API
+
+#pragma region Timeline Recorder API
+
+FString UStageManagerSubsystem::DumpTimeline(const FString& Filename) const
+{
+	FStageTimelineCapture Capture;
+	TimelineRecorder.BuildCapture(Capture);
+
+	Capture.WorldName = GetWorld() ? GetWorld()->GetMapName() : FString();
+	for (const auto& Pair : StageRegistry)
+	{
+		if (const AStage* Stage = Pair.Value.Get())
+		{
+			Capture.StageNames.Add(Pair.Key, Stage->GetStageName());
+		}
+	}
+
+	FString OutputPath = Filename;
+	if (OutputPath.IsEmpty())
+	{
+		OutputPath = FPaths::ProfilingDir() / TEXT("StageRecordings") /
+			FString::Printf(TEXT("StageTimeline_%s%s"), *FDateTime::Now().ToString(), FStageTimelineCapture::FileExtension);
+	}
+
+	if (!Capture.SaveToFile(OutputPath))
+	{
+		UE_LOG(LogStageManager, Warning, TEXT("DumpTimeline: Failed to write '%s'"), *OutputPath);
+		return FString();
+	}
+
+	UE_LOG(LogStageManager, Log, TEXT("DumpTimeline: Wrote %d events, %d frame samples to '%s'"),
+		Capture.Events.Num(), Capture.FrameSamples.Num(), *OutputPath);
+	return OutputPath;
+}
+
+#pragma endregion Timeline Recorder API
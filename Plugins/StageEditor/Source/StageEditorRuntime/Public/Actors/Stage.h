@@ -11,6 +11,7 @@
 
 // Forward declarations
 class UDataLayerAsset;
+class UDataLayerManager;
 class UStageEntityComponent;
 class UBoxComponent;
 class UStageTriggerZoneComponent;
@@ -32,6 +33,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnActiveActsChanged);
 /** Broadcast when any Entity's state changes within this Stage. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnStageEntityStateChanged, int32, EntityID, int32, OldState, int32, NewState);
 
+/** Broadcast when the Stage runtime state changes (e.g. Preloading -> Loaded once streaming completes). */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStageRuntimeStateChanged, EStageRuntimeState, NewState, EStageRuntimeState, OldState);
+
 /**
  * @brief The "Director" of the stage.
  * Manages a list of Acts and a registry of Entities.
@@ -70,6 +74,13 @@ protected:
 	 */
 	virtual void BeginPlay() override;
 
+	/**
+	 * @brief Called when the Stage leaves play.
+	 * Ends any pending DataLayer wait (poll timer + DataLayerManager notification) so neither
+	 * outlives the Stage, then updates the Stage stats.
+	 */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/**
 	 * @brief Called when actor is constructed (editor and runtime).
 	 * Used to apply built-in zone visibility settings.
@@ -126,6 +137,13 @@ public:
 	 */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stage")
 	TMap<int32, TSoftObjectPtr<AActor>> EntityRegistry;
+
+	/**
+	 * Next EntityID handed out by RegisterEntity/RegisterEntities.
+	 * Monotonic so IDs are never reused; re-validated against EntityRegistry on PostLoad and undo.
+	 */
+	UPROPERTY(VisibleAnywhere, Category = "Stage", AdvancedDisplay)
+	int32 NextEntityID = 1;
 #pragma endregion Core Data
 
 #pragma region Trigger Zones
@@ -157,6 +175,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage|Trigger", meta = (DisplayName = "ActivateZone Extent"))
 	FVector ActivateZoneExtent = FVector(1000.0f, 1000.0f, 400.0f);
 
+	/**
+	 * Seconds to wait after the last actor leaves the LoadZone before unloading.
+	 * Re-entering the LoadZone during the delay cancels the unload. 0 (default) = unload immediately.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage|Trigger|Hysteresis", meta = (ClampMin = "0.0", Units = "s"))
+	float UnloadDelay = 0.0f;
+
+	/**
+	 * Extra distance around every LoadZone that departed actors must clear before the Stage unloads.
+	 * Acts as a larger unload extent so boundary walkers don't thrash. 0 (default) = LoadZone bounds.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage|Trigger|Hysteresis", meta = (ClampMin = "0.0", Units = "cm"))
+	float UnloadExtentPadding = 0.0f;
+
 	//----------------------------------------------------------------
 	// Trigger Zone Filtering (shared settings for built-in zones)
 	//----------------------------------------------------------------
@@ -365,6 +397,21 @@ public:
 	UPROPERTY(Transient)
 	TSet<TObjectPtr<AActor>> OverlappingActivateZoneActors;
 
+	/**
+	 * Maximum time (seconds, real time) Preloading/Unloading waits for World Partition
+	 * to finish streaming the Stage DataLayer. On timeout the transition completes anyway
+	 * and a warning is logged. 0 = wait indefinitely.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage|DataLayer", meta = (ClampMin = "0.0", Units = "s"))
+	float DataLayerTransitionTimeout = 10.0f;
+
+	/**
+	 * Priority used by the StageManagerSubsystem streaming scheduler when several Stages
+	 * are waiting to load or activate. Higher values go first; ties are ordered by distance.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stage|DataLayer")
+	int32 StreamingPriority = 0;
+
 	//----------------------------------------------------------------
 	// State Lock Mechanism (for Subsystem control)
 	//----------------------------------------------------------------
@@ -462,6 +509,13 @@ protected:
 	 */
 	void InternalGotoState(EStageRuntimeState NewState);
 
+	/**
+	 * @brief Performs the exit / update / broadcast / enter sequence with its instrumentation
+	 * (trace, stats, timeline). Shared by InternalGotoState and ForceStageStateOverride; no lock check.
+	 * @param NewState The target runtime state (must differ from CurrentStageState).
+	 */
+	void ExecuteStateTransition(EStageRuntimeState NewState);
+
 	/**
 	 * @brief Called when entering a new state. Handles state-specific initialization.
 	 * @param State The state being entered.
@@ -486,6 +540,91 @@ protected:
 	 */
 	void OnStageDataLayerUnloaded();
 
+	/**
+	 * @brief Starts waiting for the Stage DataLayer to reach TargetState.
+	 * Listens to the DataLayerManager runtime-state notifications and polls World Partition
+	 * streaming completion until done or DataLayerTransitionTimeout elapses.
+	 * Completes synchronously when there is nothing to wait for (no DataLayer/World Partition).
+	 * @param TargetState Loaded (from Preloading) or Unloaded (from Unloading).
+	 */
+	void BeginStageDataLayerTransition(EDataLayerRuntimeState TargetState);
+
+	/** @brief Stops waiting for the pending DataLayer transition (timer + delegate). */
+	void EndStageDataLayerTransition();
+
+	/** @brief Checks the pending transition; fires OnStageDataLayerLoaded/Unloaded when complete or timed out. */
+	void PollStageDataLayerTransition();
+
+	/**
+	 * @brief Checks whether the Stage DataLayer has reached TargetState and all its cells finished streaming.
+	 * @return True if complete, or if completion cannot be tracked (no DataLayerManager/instance).
+	 */
+	bool IsStageDataLayerTransitionComplete(EDataLayerRuntimeState TargetState) const;
+
+	/** DataLayerManager callback; re-checks the pending transition when our DataLayer changes. */
+	UFUNCTION()
+	void HandleDataLayerRuntimeStateChanged(const UDataLayerInstance* DataLayer, EDataLayerRuntimeState State);
+
+	/** Polls the pending DataLayer transition while Preloading/Unloading. */
+	FTimerHandle DataLayerTransitionTimerHandle;
+
+	/** DataLayer state the current Preloading/Unloading transition waits for. */
+	EDataLayerRuntimeState PendingDataLayerTargetState = EDataLayerRuntimeState::Unloaded;
+
+	/** Real time at which the pending DataLayer transition started (for timeout). */
+	double DataLayerTransitionStartTime = 0.0;
+
+	/** Manager whose OnDataLayerInstanceRuntimeStateChanged we are bound to (it may be unreachable via the world during teardown). */
+	TWeakObjectPtr<UDataLayerManager> BoundDataLayerManager;
+
+	/** Set by GotoState(Active) while loading; Loaded continues straight to Active. */
+	bool bActivateWhenLoaded = false;
+
+	/** Set when the LoadZone is re-entered during Unloading; Unloaded continues straight to Preloading. */
+	bool bPreloadWhenUnloaded = false;
+
+	/** Polls the pending (debounced) unload. */
+	FTimerHandle PendingUnloadTimerHandle;
+
+	/** World time the last actor left the LoadZone (valid while an unload is pending). */
+	double PendingUnloadStartTime = 0.0;
+
+	/** Actors that left the LoadZone while the unload is pending (checked against UnloadExtentPadding). */
+	TArray<TWeakObjectPtr<AActor>> PendingUnloadActors;
+
+	/** Number of unload cycles avoided because an actor re-entered during the pending unload. */
+	int32 AvoidedUnloadCount = 0;
+
+	/** Bumped alongside every state/Act broadcast and lock change (see GetDebugRevision). */
+	uint32 DebugRevision = 0;
+
+	/** True between BeginPlay and EndPlay, while this Stage is counted in the STAT Stage per-state gauges. */
+	bool bCountedInStageStats = false;
+
+	/** @brief Starts the debounced unload after the last actor left the LoadZone. */
+	void BeginPendingUnload(AActor* DepartedActor);
+
+	/**
+	 * @brief Stops the pending unload.
+	 * @param bAvoided True if cancelled by a re-entry (counted as an avoided unload cycle).
+	 */
+	void CancelPendingUnload(bool bAvoided);
+
+	/** @brief Unloads once UnloadDelay has elapsed and departed actors cleared UnloadExtentPadding. */
+	void CheckPendingUnload();
+
+	/** True while loaded by a velocity prediction that no actor has confirmed by entering the LoadZone. */
+	bool bPredictivePreload = false;
+
+	/** Actor that most recently entered the LoadZone. Passed to the streaming scheduler for distance ordering. */
+	TWeakObjectPtr<AActor> LastStreamingInstigator;
+
+	/**
+	 * @brief Asks the streaming scheduler to activate this Loaded Stage within its per-frame budget.
+	 * Activates immediately when no StageManagerSubsystem is available.
+	 */
+	void RequestStageActivation(AActor* Instigator);
+
 	/**
 	 * @brief Applies state to Acts that have bFollowStageState=true.
 	 * Called from OnEnterState() when Stage state changes.
@@ -511,6 +650,46 @@ protected:
 	void UnloadAllActDataLayers();
 
 public:
+	//----------------------------------------------------------------
+	// Streaming Scheduler Callbacks
+	//----------------------------------------------------------------
+
+	/**
+	 * @brief Called by UStageManagerSubsystem when a load slot is granted.
+	 * Requests the Stage DataLayer load and waits for streaming. No-op unless Preloading.
+	 */
+	void StartScheduledStageLoad();
+
+	/**
+	 * @brief Called by UStageManagerSubsystem when activation budget is granted.
+	 * Transitions Loaded -> Active. No-op in any other state.
+	 */
+	void StartScheduledStageActivation();
+
+	/**
+	 * @brief Starts Preloading because a source's predicted path crosses a LoadZone.
+	 * The load is held by the prediction until an actor actually enters the LoadZone.
+	 * @param Source The actor whose extrapolated path triggered the load.
+	 * @return True if Preloading was started (Stage was Unloaded and not locked).
+	 */
+	bool RequestPredictivePreload(AActor* Source);
+
+	/**
+	 * @brief Drops a prediction that did not materialize. Unloads if nobody is in the LoadZone.
+	 */
+	void ExpirePredictivePreload();
+
+	/** @brief True while the Stage is loaded only because of a velocity prediction. */
+	bool IsPredictivePreload() const { return bPredictivePreload; }
+
+	/** @brief True while a debounced unload is waiting (see UnloadDelay / UnloadExtentPadding). */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stage|Runtime")
+	bool IsUnloadPending() const { return PendingUnloadTimerHandle.IsValid(); }
+
+	/** @brief Number of unload cycles avoided by hysteresis since BeginPlay. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stage|Runtime")
+	int32 GetAvoidedUnloadCount() const { return AvoidedUnloadCount; }
+
 	//----------------------------------------------------------------
 	// Stage State Query API
 	//----------------------------------------------------------------
@@ -623,6 +802,20 @@ public:
 	/** Broadcast when any Entity's state changes within this Stage. */
 	UPROPERTY(BlueprintAssignable, Category = "Stage|Events")
 	FOnStageEntityStateChanged OnStageEntityStateChanged;
+
+	/**
+	 * Broadcast on every runtime state transition.
+	 * Loaded/Unloaded are only entered once the Stage DataLayer has finished streaming,
+	 * so gameplay can bind here to await a GotoState() request.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Stage|Events")
+	FOnStageRuntimeStateChanged OnStageStateChanged;
+
+	/**
+	 * @brief Counter that changes whenever this Stage broadcasts a state/Act change or a lock changes.
+	 * Polling observers (e.g. AStageDebugHUD) compare it to skip rebuilding derived data.
+	 */
+	uint32 GetDebugRevision() const { return DebugRevision; }
 #pragma endregion Events
 
 #pragma region Runtime Logic
@@ -652,7 +845,8 @@ public:
 
 	/**
 	 * @brief Activates multiple Acts in order (last one has the highest priority).
-	 * Equivalent to calling ActivateAct for each in sequence.
+	 * Runs inside an Act batch: each Entity is set once, to its final state,
+	 * and only if that state differs from its current one.
 	 * @param ActIDs Array of Act IDs to activate.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Stage|Acts")
@@ -665,6 +859,38 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stage|Acts")
 	void DeactivateAllActs();
 
+	//----------------------------------------------------------------
+	// Act Batch API
+	//----------------------------------------------------------------
+
+	/**
+	 * @brief Opens an Act batch. Nested calls are reference counted.
+	 * While a batch is open, EntityState overrides from ActivateAct/ApplyActEntityStatesOnly
+	 * are collected instead of applied. Prefer FScopedActBatch over calling this directly.
+	 */
+	void BeginActBatch();
+
+	/**
+	 * @brief Closes an Act batch. When the outermost batch closes, each collected Entity
+	 * is set to its final state once, skipping Entities already in that state.
+	 */
+	void EndActBatch();
+
+	/** Returns true while an Act batch is open. */
+	bool IsInActBatch() const { return ActBatchDepth > 0; }
+
+	/**
+	 * @brief RAII helper that wraps a sequence of Act changes in a single batch.
+	 */
+	struct FScopedActBatch
+	{
+		explicit FScopedActBatch(AStage* InStage) : Stage(InStage) { if (Stage) { Stage->BeginActBatch(); } }
+		~FScopedActBatch() { if (Stage) { Stage->EndActBatch(); } }
+
+	private:
+		AStage* Stage;
+	};
+
 	//----------------------------------------------------------------
 	// Multi-Act Query API
 	//----------------------------------------------------------------
@@ -712,7 +938,7 @@ public:
 
 	/**
 	 * @brief Gets the effective state of an Entity considering all active Acts.
-	 * Iterates from highest to lowest priority, returns first defined state.
+	 * O(1) lookup into the effective-state table (highest priority Act wins).
 	 * @param EntityID The Entity to query.
 	 * @return The effective state, or current actual state if no Act defines it.
 	 */
@@ -721,12 +947,26 @@ public:
 
 	/**
 	 * @brief Gets which active Act is controlling an Entity's state.
+	 * O(1) lookup into the effective-state table.
 	 * @param EntityID The Entity to query.
 	 * @return The ActID with the highest priority that defines this Entity, or -1 if none.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stage|Entities")
 	int32 GetControllingActForEntity(int32 EntityID) const;
 
+	/**
+	 * @brief Gets the resolved state of every Entity overridden by at least one active Act.
+	 * Entities not defined by any active Act are absent from the map.
+	 * @return EntityID → (State, ControllingActID). Valid until the next Act change.
+	 */
+	const TMap<int32, FStageEffectiveEntityState>& GetEffectiveEntityStates() const;
+
+	/**
+	 * @brief Forces a full recompute of the effective-state table on next query.
+	 * Call after editing an Act's EntityStateOverrides directly.
+	 */
+	void MarkEffectiveEntityStatesDirty() { bEffectiveEntityStatesDirty = true; }
+
 	//----------------------------------------------------------------
 	// Legacy/Utility API
 	//----------------------------------------------------------------
@@ -734,6 +974,7 @@ public:
 	/**
 	 * @brief Applies an Act's EntityState overrides WITHOUT changing DataLayer.
 	 * Use this when you want to preview Act states without streaming.
+	 * Inside an Act batch the overrides are deferred until EndActBatch().
 	 * @param ActID The Act whose EntityStates to apply.
 	 * @return True if Act was found and states were applied.
 	 */
@@ -860,6 +1101,28 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stage|Acts")
 	bool DoesActExist(int32 ActID) const;
 
+	/**
+	 * @brief Finds an Act by its ID using the transient ActID index (O(1)).
+	 * @param ActID The Act to find.
+	 * @return Pointer into Acts, or nullptr if not found. Invalidated by any Acts modification.
+	 */
+	FAct* FindActByID(int32 ActID);
+	const FAct* FindActByID(int32 ActID) const;
+
+	/**
+	 * @brief Gets the index of an Act within the Acts array.
+	 * Falls back to a full index rebuild if the cached entry is missing or stale.
+	 * @param ActID The Act to find.
+	 * @return Index into Acts, or INDEX_NONE if not found.
+	 */
+	int32 FindActIndex(int32 ActID) const;
+
+	/**
+	 * @brief Rebuilds the ActID → index lookup table from the Acts array.
+	 * Call after modifying Acts directly (outside AddAct/RemoveAct).
+	 */
+	void RebuildActIndex() const;
+
 	//----------------------------------------------------------------
 	// DataLayer Runtime Control API
 	//----------------------------------------------------------------
@@ -952,6 +1215,7 @@ public:
 
 	virtual void PostActorCreated() override;
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditUndo() override;
 	virtual void BeginDestroy() override;
 #endif
 
@@ -962,6 +1226,15 @@ public:
 	 */
 	int32 RegisterEntity(AActor* NewEntity);
 
+	/**
+	 * @brief Registers several Entities at once.
+	 * Reserves the registry up front, adds all Entities to the Default Act in one pass
+	 * and marks effective states dirty once, instead of once per Entity.
+	 * @param NewEntities The entity actors to register.
+	 * @return The assigned EntityIDs, parallel to NewEntities (-1 where registration failed).
+	 */
+	TArray<int32> RegisterEntities(TArrayView<AActor* const> NewEntities);
+
 	/** 
 	 * @brief Unregisters an Entity by ID. Removes from EntityRegistry and all Acts.
 	 * @param EntityID The ID of the entity to unregister.
@@ -975,7 +1248,21 @@ public:
 	 */
 	void RemoveEntityFromAct(int32 EntityID, int32 ActID);
 
-	/** 
+	/**
+	 * @brief Appends a new Act and registers it in the ActID index.
+	 * @param NewAct The Act to add (SUID.ActID must already be assigned).
+	 * @return The index of the new Act within Acts.
+	 */
+	int32 AddAct(const FAct& NewAct);
+
+	/**
+	 * @brief Re-indexes this Stage's DataLayer assignments in the StageManagerSubsystem.
+	 * Call after assigning StageDataLayerAsset or an Act's AssociatedDataLayer directly.
+	 * AddAct/RemoveAct and Details panel edits call this automatically.
+	 */
+	void NotifyDataLayersChanged();
+
+	/**
 	 * @brief Removes an Act by its ActID.
 	 * @param ActID The ID of the act to remove.
 	 */
@@ -988,4 +1275,63 @@ public:
 	 */
 	AActor* GetEntityByID(int32 EntityID) const;
 #pragma endregion Editor API
+
+private:
+#pragma region Act Index
+	/**
+	 * Transient lookup table: ActID → index into Acts.
+	 * Rebuilt on PostLoad/PostEditChangeProperty/PostEditUndo and kept in sync by AddAct/RemoveAct.
+	 * Entries are validated on lookup, so direct edits to Acts only cost one rebuild; misses do not rebuild.
+	 */
+	mutable TMap<int32, int32> ActIndexByID;
+
+	/** Acts.Num() when ActIndexByID was last consistent; a size mismatch means Acts was edited directly. */
+	mutable int32 IndexedActCount = 0;
+#pragma endregion Act Index
+
+#pragma region Effective State Table
+	/**
+	 * Transient table: EntityID → (effective state, controlling ActID) over ActiveActIDs.
+	 * Patched incrementally by ActivateAct/DeactivateAct; fully rebuilt lazily when dirty.
+	 */
+	mutable TMap<int32, FStageEffectiveEntityState> EffectiveEntityStates;
+
+	/** When true, EffectiveEntityStates is rebuilt from ActiveActIDs on next query. */
+	mutable bool bEffectiveEntityStatesDirty = true;
+
+	/** Rebuilds EffectiveEntityStates from scratch (lowest to highest priority). */
+	void RebuildEffectiveEntityStates() const;
+
+	/** Re-resolves a single Entity by walking ActiveActIDs from highest priority. */
+	void ResolveEffectiveEntityState(int32 EntityID);
+#pragma endregion Effective State Table
+
+#pragma region Entity Registration
+	/**
+	 * Validates NewEntity, assigns the next EntityID and syncs its UStageEntityComponent.
+	 * Does not touch Acts; callers add the Default Act override.
+	 * @return The assigned EntityID, or -1 if NewEntity cannot be registered.
+	 */
+	int32 AllocateEntity(AActor* NewEntity);
+
+	/** Returns the Default Act (ID 1), recreating it if missing. */
+	FAct& FindOrAddDefaultAct();
+
+	/** Raises NextEntityID above every key in EntityRegistry (legacy data, undo/redo). */
+	void ValidateNextEntityID();
+#pragma endregion Entity Registration
+
+#pragma region Act Batch
+	/** Nesting depth of BeginActBatch/EndActBatch. */
+	int32 ActBatchDepth = 0;
+
+	/**
+	 * EntityID → final requested state collected while a batch is open.
+	 * Later writes overwrite earlier ones, so the last (highest priority) Act wins.
+	 */
+	TMap<int32, int32> PendingBatchEntityStates;
+
+	/** Applies PendingBatchEntityStates, skipping Entities already in their target state. */
+	void FlushActBatch();
+#pragma endregion Act Batch
 };
@@ -3,12 +3,63 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Core/StageCoreTypes.h"
+#include "Engine/CollisionProfile.h"
+#include "Containers/Ticker.h"
 #include "StageEntityComponent.generated.h"
 
 class AStage;
+class UMaterialInterface;
+class UPrimitiveComponent;
+class USceneComponent;
+class UStaticMesh;
+class UStaticMeshComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEntityStateChanged, int32, NewState, int32, OldState);
 
+/**
+ * @brief Native visual settings for one Entity state.
+ * Applied in C++ by UStageEntityComponent when the Entity enters the state,
+ * so simple prop switching does not need a Blueprint event per Entity.
+ * Settings left unset show the Entity's original look, not the previous state's.
+ */
+USTRUCT(BlueprintType)
+struct STAGEEDITORRUNTIME_API FStageEntityStateVisual
+{
+	GENERATED_BODY()
+
+	/** If true, sets visibility (and hidden-in-game) on the target primitives. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visibility", meta = (InlineEditConditionToggle))
+	bool bSetVisibility = false;
+
+	/** Whether the target primitives are visible in this state. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Visibility", meta = (EditCondition = "bSetVisibility"))
+	bool bVisible = true;
+
+	/** If true, applies CollisionProfile to the target primitives. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision", meta = (InlineEditConditionToggle))
+	bool bSetCollisionProfile = false;
+
+	/** Collision profile used in this state. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision", meta = (EditCondition = "bSetCollisionProfile"))
+	FCollisionProfileName CollisionProfile;
+
+	/** Mesh swapped onto the target StaticMeshComponent. None keeps the current mesh. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
+	TObjectPtr<UStaticMesh> StaticMesh = nullptr;
+
+	/** Material overrides by slot index on the target StaticMeshComponent. None entries keep the current material. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mesh")
+	TArray<TObjectPtr<UMaterialInterface>> MaterialOverrides;
+
+	/** If true, offsets the target's relative transform from its original value. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (InlineEditConditionToggle))
+	bool bApplyTransformOffset = false;
+
+	/** Offset composed onto the target's original relative transform in this state. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transform", meta = (EditCondition = "bApplyTransformOffset"))
+	FTransform TransformOffset;
+};
+
 /**
  * @brief Core component that makes any Actor a controllable Entity in the Stage system.
  * Can be added to any Actor to make it respond to Stage state changes.
@@ -24,13 +75,13 @@ public:
 protected:
 	virtual void BeginPlay() override;
 
-#if WITH_EDITOR
 	/**
 	 * Called when component is registered.
-	 * Used to prevent adding this component to Stage actors (nested Stage is not allowed).
+	 * Used to prevent adding this component to Stage actors (nested Stage is not allowed),
+	 * and to drop cached StateVisuals targets when the owner's components are (re)created
+	 * (the current state's visuals are re-applied next tick).
 	 */
 	virtual void OnRegister() override;
-#endif
 
 public:	
 	//----------------------------------------------------------------
@@ -73,10 +124,52 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stage Entity")
 	int32 PreviousEntityState = 0;
 
-	/** Event fired when EntityState changes. Implement logic here in Blueprints. */
+	/**
+	 * Event fired when EntityState changes. Implement logic here in Blueprints.
+	 * Entities driven by StateVisuals only fire it when bBroadcastWithStateVisuals is set.
+	 */
 	UPROPERTY(BlueprintAssignable, Category = "Stage Entity")
 	FOnEntityStateChanged OnEntityStateChanged;
 
+	//----------------------------------------------------------------
+	// State Visuals (native)
+	//----------------------------------------------------------------
+
+	/**
+	 * Per-state visual table applied natively on every state change. Key: EntityState.
+	 * States without an entry show the original look captured before the first state was applied.
+	 * Game worlds only: editor previews never write these onto components saved with the level.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stage Entity|State Visuals")
+	TMap<int32, FStageEntityStateVisual> StateVisuals;
+
+	/**
+	 * Name of the component StateVisuals applies to.
+	 * None: visibility/collision on all primitives, mesh/materials on the first StaticMeshComponent,
+	 * transform offset on the root component.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stage Entity|State Visuals")
+	FName VisualTargetComponentName;
+
+	/**
+	 * Opt-in: also fire OnEntityStateChanged (and the editor construction-script refresh) for an Entity
+	 * that has StateVisuals. Entities without StateVisuals always fire it.
+	 * Since StateVisuals only apply in game worlds, this is also how such an Entity previews in the editor.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stage Entity|State Visuals")
+	bool bBroadcastWithStateVisuals = false;
+
+	/**
+	 * @brief Applies the StateVisuals entry for the given state, or the original look if it has none.
+	 * No-op outside game worlds.
+	 * @param State The state whose visuals to apply.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stage Entity")
+	void ApplyStateVisuals(int32 State);
+
+	/** @return True if state changes should reach Blueprint (no StateVisuals, or opted in). */
+	bool ShouldBroadcastStateChanges() const { return StateVisuals.Num() == 0 || bBroadcastWithStateVisuals; }
+
 	//----------------------------------------------------------------
 	// State Control API
 	//----------------------------------------------------------------
@@ -161,4 +254,54 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Stage Entity")
 	void ClearOrphanedState();
+
+private:
+	/** Resolves and caches the components StateVisuals applies to. */
+	void ResolveVisualTargets();
+
+	/** Drops cached targets (components may have been recreated). */
+	void InvalidateVisualTargets();
+
+	/** Applies the current state's visuals next tick, once the owner's components are all registered. */
+	void ScheduleDeferredStateVisuals();
+
+	/** Pending one-shot ticker from ScheduleDeferredStateVisuals. */
+	FTSTicker::FDelegateHandle PendingStateVisualsHandle;
+
+	/** Primitives receiving visibility/collision. */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> VisualPrimitiveTargets;
+
+	/** StaticMeshComponent receiving mesh swaps and material overrides. */
+	TWeakObjectPtr<UStaticMeshComponent> VisualMeshTarget;
+
+	/** SceneComponent receiving transform offsets. */
+	TWeakObjectPtr<USceneComponent> VisualTransformTarget;
+
+	/** Original look of one primitive target, restored for settings a state does not set. */
+	struct FVisualPrimitiveBase
+	{
+		bool bVisible = true;
+		bool bHiddenInGame = false;
+		FName CollisionProfile;
+	};
+
+	/** Original look per primitive, captured once per object so state changes never feed back into it. */
+	TMap<TWeakObjectPtr<UPrimitiveComponent>, FVisualPrimitiveBase> VisualPrimitiveBases;
+
+	/** VisualMeshTarget's mesh before any state swapped it. */
+	TWeakObjectPtr<UStaticMesh> VisualBaseStaticMesh;
+
+	/** VisualMeshTarget's override materials before any state changed them (None = mesh default). */
+	TArray<TWeakObjectPtr<UMaterialInterface>> VisualBaseMaterials;
+
+	/** Which object VisualBaseStaticMesh/VisualBaseMaterials were captured from. */
+	TWeakObjectPtr<UStaticMeshComponent> VisualBaseMeshOwner;
+
+	/** VisualTransformTarget's relative transform before any offset was applied. */
+	FTransform VisualBaseRelativeTransform;
+
+	/** Which object VisualBaseRelativeTransform was captured from. */
+	TWeakObjectPtr<USceneComponent> VisualBaseTransformOwner;
+
+	bool bVisualTargetsResolved = false;
 };
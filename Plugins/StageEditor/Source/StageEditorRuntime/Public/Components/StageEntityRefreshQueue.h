@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+
+#if WITH_EDITOR
+/**
+ * @brief Editor-only queue that defers Entity construction-script reruns to end of frame.
+ *
+ * UStageEntityComponent::SetEntityState used to call RerunConstructionScripts() on every change,
+ * so previewing an Act with N Entities reran N construction scripts synchronously.
+ * State changes now only enqueue the owner; each owner is rerun at most once per flush,
+ * and large batches are spread across frames within a fixed time budget.
+ */
+class STAGEEDITORRUNTIME_API FStageEntityRefreshQueue
+{
+public:
+	/** Get singleton instance */
+	static FStageEntityRefreshQueue& Get();
+
+	/**
+	 * @brief Marks an Entity owner as needing a construction-script rerun at end of frame.
+	 * @param Owner The actor whose visuals depend on its Entity state.
+	 */
+	void Enqueue(AActor* Owner);
+
+	/**
+	 * @brief Reruns all pending construction scripts immediately, ignoring the time budget.
+	 * Use when callers need up-to-date visuals synchronously (e.g. before capturing or saving).
+	 */
+	void Flush();
+
+	/** @return Number of owners still waiting for a rerun. */
+	int32 GetPendingCount() const { return PendingOwners.Num() - NextPendingIndex; }
+
+	/** Unbinds from end-of-frame and drops pending owners (called on module shutdown). */
+	void Shutdown();
+
+private:
+	FStageEntityRefreshQueue() = default;
+
+	FStageEntityRefreshQueue(const FStageEntityRefreshQueue&) = delete;
+	FStageEntityRefreshQueue& operator=(const FStageEntityRefreshQueue&) = delete;
+
+	/** End-of-frame callback: reruns pending owners until the budget is spent. */
+	void HandleEndFrame();
+
+	/** Reruns owners from NextPendingIndex, stopping once BudgetSeconds is exceeded (<= 0 means no limit). */
+	void ProcessPending(double BudgetSeconds);
+
+	/** Owners in enqueue order; entries before NextPendingIndex are already processed. */
+	TArray<TWeakObjectPtr<AActor>> PendingOwners;
+
+	/** De-duplicates PendingOwners so each owner is rerun once per flush. */
+	TSet<TWeakObjectPtr<AActor>> PendingOwnerSet;
+
+	/** Read cursor into PendingOwners (avoids O(N) RemoveAt while time-slicing). */
+	int32 NextPendingIndex = 0;
+
+	FDelegateHandle EndFrameHandle;
+
+	/** Per-frame rerun budget (seconds); at least one owner is processed each frame. */
+	static constexpr double FrameBudgetSeconds = 0.004;
+};
+#endif
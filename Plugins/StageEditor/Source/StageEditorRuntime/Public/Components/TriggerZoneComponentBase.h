@@ -174,6 +174,40 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "TriggerZone")
 	bool IsZoneEnabled() const { return bZoneEnabled; }
 
+	//----------------------------------------------------------------
+	// Manual Enter/Exit (non-physics)
+	//----------------------------------------------------------------
+
+	/**
+	 * @brief Processes an actor entering the zone without a physics overlap.
+	 * Applies the same enabled/filter checks and events as the overlap path.
+	 * Used by StageManagerSubsystem proximity streaming.
+	 * @param Actor The actor that entered the zone.
+	 */
+	void NotifyActorEnter(AActor* Actor);
+
+	/**
+	 * @brief Processes an actor exiting the zone without a physics overlap.
+	 * @param Actor The actor that exited the zone.
+	 */
+	void NotifyActorExit(AActor* Actor);
+
+	/**
+	 * @brief Tests whether a world-space point lies inside this (possibly rotated/scaled) box.
+	 * @param WorldLocation The point to test.
+	 * @param Padding Extra world-space distance added to every side of the box.
+	 * @return True if inside.
+	 */
+	bool IsPointInZone(const FVector& WorldLocation, float Padding = 0.0f) const;
+
+	/**
+	 * @brief Tests whether a world-space segment crosses this (possibly rotated/scaled) box.
+	 * @param Start Segment start.
+	 * @param End Segment end.
+	 * @return True if any part of the segment is inside.
+	 */
+	bool DoesSegmentIntersectZone(const FVector& Start, const FVector& End) const;
+
 protected:
 	//----------------------------------------------------------------
 	// Lifecycle
@@ -382,6 +382,28 @@ struct STAGEEDITORRUNTIME_API FSUID
 	bool IsEntityLevel() const { return StageID > 0 && EntityID > 0; }
 };
 
+/**
+ * @brief Resolved state of an Entity across all active Acts.
+ * Produced by AStage's effective-state table; see AStage::GetEffectiveEntityStates().
+ */
+USTRUCT(BlueprintType)
+struct STAGEEDITORRUNTIME_API FStageEffectiveEntityState
+{
+	GENERATED_BODY()
+
+	/** The state defined by the highest-priority active Act that overrides this Entity. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stage")
+	int32 State = 0;
+
+	/** The active Act that supplies State. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stage")
+	int32 ControllingActID = -1;
+
+	FStageEffectiveEntityState() {}
+	FStageEffectiveEntityState(int32 InState, int32 InControllingActID)
+		: State(InState), ControllingActID(InControllingActID) {}
+};
+
 /**
  * @brief Defines a "Scene" or "State" of the Stage.
  * Contains the target state for a set of Entities.
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "StageStreamingSettings.generated.h"
+
+/**
+ * @brief Stage Streaming Settings
+ * Controls how UStageManagerSubsystem schedules Stage DataLayer loads and activations.
+ * Appears in Project Settings → Plugins → Stage Streaming
+ */
+UCLASS(config = Game, defaultconfig, meta = (DisplayName = "Stage Streaming"))
+class STAGEEDITORRUNTIME_API UStageStreamingSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UStageStreamingSettings();
+
+	/** Get singleton instance */
+	static UStageStreamingSettings* Get();
+
+	//----------------------------------------------------------------
+	// Streaming Scheduler
+	//----------------------------------------------------------------
+
+	/**
+	 * When enabled, Stage Preloading requests are queued and dispatched by the
+	 * StageManagerSubsystem instead of loading the instant a LoadZone is entered.
+	 * Only applies to game worlds.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduler", meta = (DisplayName = "Enable Streaming Scheduler"))
+	bool bEnableStreamingScheduler = true;
+
+	/** Maximum number of Stage DataLayers streaming in at the same time. */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduler",
+		meta = (DisplayName = "Max Concurrent Loads", ClampMin = "1", EditCondition = "bEnableStreamingScheduler"))
+	int32 MaxConcurrentStageLoads = 2;
+
+	/** Maximum number of Stages allowed to enter Active per frame. */
+	UPROPERTY(config, EditAnywhere, Category = "Scheduler",
+		meta = (DisplayName = "Max Activations Per Frame", ClampMin = "1", EditCondition = "bEnableStreamingScheduler"))
+	int32 MaxStageActivationsPerFrame = 1;
+
+	//----------------------------------------------------------------
+	// Proximity Streaming
+	//----------------------------------------------------------------
+
+	/**
+	 * When enabled, Stage-bound trigger zones stop using physics overlaps. Instead the
+	 * StageManagerSubsystem keeps them in a spatial hash and tests tracked streaming
+	 * sources against them at a fixed rate, firing the same enter/exit events.
+	 * Only applies to game worlds.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Proximity", meta = (DisplayName = "Enable Proximity Streaming"))
+	bool bEnableProximityStreaming = false;
+
+	/** How often streaming sources are evaluated against zones (Hz). */
+	UPROPERTY(config, EditAnywhere, Category = "Proximity",
+		meta = (DisplayName = "Update Rate", ClampMin = "1.0", ClampMax = "60.0", Units = "Hz", EditCondition = "bEnableProximityStreaming"))
+	float ProximityUpdateRate = 10.0f;
+
+	/** Size of a spatial hash cell (XY). Should be on the order of a typical LoadZone. Also used by predictive preload. */
+	UPROPERTY(config, EditAnywhere, Category = "Proximity",
+		meta = (DisplayName = "Cell Size", ClampMin = "100.0", Units = "cm", EditCondition = "bEnableProximityStreaming || bEnablePredictivePreload"))
+	float ProximityCellSize = 10000.0f;
+
+	/** Automatically track every player-controlled pawn as a streaming source (proximity and predictive modes). */
+	UPROPERTY(config, EditAnywhere, Category = "Proximity", meta = (DisplayName = "Track Player Pawns"))
+	bool bTrackPlayerPawns = true;
+
+	//----------------------------------------------------------------
+	// Predictive Preloading
+	//----------------------------------------------------------------
+
+	/**
+	 * When enabled, streaming sources are extrapolated along their velocity and an Unloaded
+	 * Stage starts Preloading as soon as the predicted path crosses one of its LoadZones.
+	 * Predicted loads that are not followed by a real LoadZone entry expire and unload.
+	 * Only applies to game worlds.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Predictive", meta = (DisplayName = "Enable Predictive Preload"))
+	bool bEnablePredictivePreload = false;
+
+	/** How far ahead (seconds) source positions are extrapolated. Also the grace period before a missed prediction expires. */
+	UPROPERTY(config, EditAnywhere, Category = "Predictive",
+		meta = (DisplayName = "Lookahead Time", ClampMin = "0.1", Units = "s", EditCondition = "bEnablePredictivePreload"))
+	float PredictiveLookaheadTime = 2.0f;
+
+	/** Sources slower than this are not extrapolated (walkers load reactively). */
+	UPROPERTY(config, EditAnywhere, Category = "Predictive",
+		meta = (DisplayName = "Min Speed", ClampMin = "0.0", Units = "cm/s", EditCondition = "bEnablePredictivePreload"))
+	float PredictiveMinSpeed = 600.0f;
+
+	/** How often predictions are evaluated (Hz). */
+	UPROPERTY(config, EditAnywhere, Category = "Predictive",
+		meta = (DisplayName = "Update Rate", ClampMin = "1.0", ClampMax = "60.0", Units = "Hz", EditCondition = "bEnablePredictivePreload"))
+	float PredictiveUpdateRate = 10.0f;
+
+	//----------------------------------------------------------------
+	// UDeveloperSettings Interface
+	//----------------------------------------------------------------
+
+	virtual FName GetCategoryName() const override { return FName("Plugins"); }
+	virtual FName GetSectionName() const override { return FName("Stage Streaming"); }
+
+#if WITH_EDITOR
+	virtual FText GetSectionText() const override { return NSLOCTEXT("StageEditor", "StageStreamingSettingsName", "Stage Streaming"); }
+	virtual FText GetSectionDescription() const override { return NSLOCTEXT("StageEditor", "StageStreamingSettingsDesc", "Configure runtime Stage streaming scheduling"); }
+#endif
+};
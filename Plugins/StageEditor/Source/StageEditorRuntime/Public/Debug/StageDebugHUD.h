@@ -29,14 +29,77 @@ public:
 
 protected:
 	//----------------------------------------------------------------
-	// Drawing Methods
+	// Cached Layout
 	//----------------------------------------------------------------
 
-	/** Draw a single Stage info in simple mode */
-	void DrawStageSimple(AStage* Stage, float X, float& YOffset);
+	/** One pre-formatted HUD line. Scale/indent are relative to TextScale so settings changes need no rebuild. */
+	struct FCachedLine
+	{
+		FString Text;
+		FLinearColor Color = FLinearColor::White;
+		float IndentLevel = 0.0f;
+		float ScaleFactor = 1.0f;
+		float AdvanceFactor = 1.0f;
+	};
 
-	/** Draw a single Stage info in detailed mode */
-	void DrawStageDetailed(AStage* Stage, float X, float& YOffset);
+	/** Cached lines of one watched Stage plus the inputs they were built from. */
+	struct FCachedStageLines
+	{
+		uint32 DebugRevision = 0;
+		EDataLayerRuntimeState DataLayerState = EDataLayerRuntimeState::Unloaded;
+		int32 LoadZoneCount = 0;
+		int32 ActivateZoneCount = 0;
+		int32 AvoidedUnloadCount = 0;
+		bool bUnloadPending = false;
+		bool bDetailedMode = false;
+		bool bValid = false;
+		TArray<FCachedLine> Lines;
+	};
+
+	/** Draws the panel (everything except the frame cost bookkeeping) */
+	void DrawStageDebug();
+
+	/** Rebuilds the Stage's cached lines if it broadcast a change or its zone/DataLayer state moved */
+	const TArray<FCachedLine>& GetStageLines(AStage* Stage, bool bDetailedMode);
+
+	/** Rebuilds header lines if any of the subsystem counters changed */
+	void UpdateHeaderLines(const class UStageManagerSubsystem* Subsystem, int32 WatchedCount);
+
+	/** Draws cached lines and advances YOffset */
+	void DrawLines(const TArray<FCachedLine>& Lines, float X, float& YOffset, float Scale);
+
+	/** Build a single Stage info in simple mode */
+	void BuildStageSimpleLines(AStage* Stage, TArray<FCachedLine>& OutLines) const;
+
+	/** Build a single Stage info in detailed mode */
+	void BuildStageDetailedLines(AStage* Stage, TArray<FCachedLine>& OutLines) const;
+
+	/** Folds one DrawHUD cost sample into the average/peak readout */
+	void RecordFrameCost(double Milliseconds);
+
+	/** StageID → cached lines */
+	TMap<int32, FCachedStageLines> StageLineCache;
+
+	/** Header, streaming metrics and separator */
+	TArray<FCachedLine> HeaderLines;
+
+	/** Inputs the header was built from */
+	TArray<int32, TInlineAllocator<8>> HeaderKey;
+
+	/** Smoothed DrawHUD cost */
+	double AverageDrawMs = 0.0;
+
+	/** Worst DrawHUD cost within the current readout window */
+	double WindowPeakDrawMs = 0.0;
+
+	/** Start of the current readout window (platform seconds) */
+	double WindowStartSeconds = 0.0;
+
+	/** Formatted readout, refreshed once per window */
+	FString FrameCostText;
+
+	/** Readout refresh interval */
+	static constexpr double FrameCostWindowSeconds = 0.5;
 
 	//----------------------------------------------------------------
 	// Helper Methods
@@ -63,6 +63,10 @@ public:
 		meta = (DisplayName = "Screen Margin", ClampMin = "0.0", ClampMax = "200.0"))
 	float ScreenMargin = 50.0f;
 
+	/** Show the HUD's own draw cost (avg / peak ms) below the header */
+	UPROPERTY(config, EditAnywhere, Category = "Debug HUD", meta = (DisplayName = "Show HUD Frame Cost"))
+	bool bShowHUDFrameCost = true;
+
 	//----------------------------------------------------------------
 	// UDeveloperSettings Interface
 	//----------------------------------------------------------------
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Kinds of events captured by FStageTimelineRecorder.
+ * Stored as uint8 in capture files; append only.
+ */
+enum class EStageTimelineEventType : uint8
+{
+	/** Actor entered a TriggerZone. ValueA = zone type, Param = overlap count after the enter. */
+	ZoneEnter,
+	/** Actor left a TriggerZone. ValueA = zone type, Param = overlap count after the exit. */
+	ZoneExit,
+	/** Runtime state transition. ValueA = old state, ValueB = new state. */
+	StateChange,
+	/** Act activated. Param = ActID. */
+	ActActivated,
+	/** Act deactivated. Param = ActID. */
+	ActDeactivated,
+	/** Act DataLayer state request. Param = ActID, ValueA = target state, ValueB = success. */
+	ActDataLayerState,
+	/** Stage began waiting on its DataLayer. ValueA = target state. */
+	DataLayerTransitionBegin,
+	/** Stage stopped waiting on its DataLayer. */
+	DataLayerTransitionEnd,
+
+	Count
+};
+
+/**
+ * @brief One recorded Stage event (fixed size, no heap data).
+ */
+struct FStageTimelineEvent
+{
+	/** Seconds since recording started */
+	double Time = 0.0;
+
+	/** GFrameCounter when the event happened */
+	uint64 Frame = 0;
+
+	int32 StageID = 0;
+
+	/** Event specific (ActID, overlap count) */
+	int32 Param = 0;
+
+	EStageTimelineEventType Type = EStageTimelineEventType::StateChange;
+
+	/** Event specific small values (zone type, states, success flag) */
+	uint8 ValueA = 0;
+	uint8 ValueB = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FStageTimelineEvent& Event)
+	{
+		uint8 TypeByte = (uint8)Event.Type;
+		Ar << Event.Time << Event.Frame << Event.StageID << Event.Param << TypeByte << Event.ValueA << Event.ValueB;
+		Event.Type = (EStageTimelineEventType)TypeByte;
+		return Ar;
+	}
+};
+
+/**
+ * @brief Frame time sample recorded once per frame while recording.
+ */
+struct FStageTimelineFrameSample
+{
+	/** Seconds since recording started */
+	double Time = 0.0;
+
+	uint64 Frame = 0;
+
+	/** Game thread delta time in milliseconds */
+	float DeltaMs = 0.0f;
+
+	friend FArchive& operator<<(FArchive& Ar, FStageTimelineFrameSample& Sample)
+	{
+		Ar << Sample.Time << Sample.Frame << Sample.DeltaMs;
+		return Ar;
+	}
+};
+
+/**
+ * @brief A chronological recording, as written by Stage.Record Dump and read by the editor timeline viewer.
+ *
+ * File layout (little endian FArchive): magic, version, world name, Stage name table,
+ * events, frame samples.
+ */
+struct STAGEEDITORRUNTIME_API FStageTimelineCapture
+{
+	static constexpr uint32 FileMagic = 0x52475453; // 'STGR'
+	static constexpr uint32 FileVersion = 1;
+
+	/** Default extension for capture files */
+	static const TCHAR* FileExtension;
+
+	FString WorldName;
+
+	/** StageID → Stage name, captured at dump time */
+	TMap<int32, FString> StageNames;
+
+	/** Sorted by Time */
+	TArray<FStageTimelineEvent> Events;
+
+	/** Sorted by Time */
+	TArray<FStageTimelineFrameSample> FrameSamples;
+
+	void Serialize(FArchive& Ar);
+
+	bool SaveToFile(const FString& Filename) const;
+
+	/** @return false if the file is missing, not a capture, or a newer version */
+	bool LoadFromFile(const FString& Filename);
+
+	/** @brief Readable one-line description of an event (for logs and the timeline viewer). */
+	FString DescribeEvent(const FStageTimelineEvent& Event) const;
+
+	/** @brief Display name of an event type. */
+	static const TCHAR* GetEventTypeName(EStageTimelineEventType Type);
+};
+
+/**
+ * @brief Fixed-size ring buffer of Stage events plus per-frame frame-time samples.
+ *
+ * Owned by UStageManagerSubsystem. Recording an event is a bounds-checked struct write;
+ * when the buffer is full the oldest events are overwritten. Game thread only.
+ */
+class STAGEEDITORRUNTIME_API FStageTimelineRecorder
+{
+public:
+	~FStageTimelineRecorder();
+
+	/** Starts (or restarts) recording, discarding previous data. */
+	void Start(int32 InEventCapacity = DefaultEventCapacity, int32 InFrameCapacity = DefaultFrameCapacity);
+
+	/** Stops recording; recorded data stays available for BuildCapture. */
+	void Stop();
+
+	bool IsRecording() const { return bRecording; }
+
+	/** Appends an event if recording. */
+	void Record(EStageTimelineEventType Type, int32 StageID, int32 Param = 0, uint8 ValueA = 0, uint8 ValueB = 0);
+
+	/** Copies the buffers out in chronological order. */
+	void BuildCapture(FStageTimelineCapture& OutCapture) const;
+
+	int32 GetEventCount() const { return EventCount; }
+	int32 GetEventCapacity() const { return EventBuffer.Num(); }
+	int32 GetFrameSampleCount() const { return FrameCount; }
+
+	/** Events overwritten because the ring wrapped */
+	int64 GetDroppedEventCount() const { return DroppedEventCount; }
+
+	/** Cheap global check used by hooks before looking up a recorder */
+	static bool IsAnyRecording() { return NumActiveRecorders > 0; }
+
+	static constexpr int32 DefaultEventCapacity = 65536;
+	static constexpr int32 DefaultFrameCapacity = 36000;
+
+private:
+	void RecordFrameSample();
+
+	TArray<FStageTimelineEvent> EventBuffer;
+	int32 EventHead = 0;
+	int32 EventCount = 0;
+	int64 DroppedEventCount = 0;
+
+	TArray<FStageTimelineFrameSample> FrameBuffer;
+	int32 FrameHead = 0;
+	int32 FrameCount = 0;
+
+	double StartSeconds = 0.0;
+	bool bRecording = false;
+	FDelegateHandle EndFrameHandle;
+
+	static int32 NumActiveRecorders;
+};
@@ -3,14 +3,40 @@
 #pragma region Imports
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Engine/TimerHandle.h"
 #include "Core/StageCoreTypes.h"
+#include "Debug/StageTimelineRecorder.h"
 #include "StageManagerSubsystem.generated.h"
 #pragma endregion Imports
 
 #pragma region Forward Declarations
 class AStage;
+class UDataLayerAsset;
+class UStageTriggerZoneComponent;
 #pragma endregion Forward Declarations
 
+/**
+ * @brief Owner of a DataLayerAsset in the reverse DataLayer index.
+ * ActID is INDEX_NONE when the asset is the Stage's root DataLayer.
+ */
+struct FStageDataLayerOwner
+{
+	int32 StageID = 0;
+	int32 ActID = INDEX_NONE;
+};
+
+/**
+ * @brief A queued Stage load or activation request for the streaming scheduler.
+ */
+struct FStageStreamingRequest
+{
+	/** The Stage waiting for a slot. */
+	TWeakObjectPtr<AStage> Stage;
+
+	/** The actor that caused the request (used for distance ordering). May be null. */
+	TWeakObjectPtr<AActor> Instigator;
+};
+
 /**
  * @brief World Subsystem for managing Stage registration, ID allocation, and cross-Stage communication.
  *
@@ -49,6 +75,9 @@ public:
 
 	/** Determines if this subsystem should be created for the given world. */
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	/** Starts proximity streaming evaluation when enabled. */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
 #pragma endregion Lifecycle
 
 public:
@@ -252,6 +281,144 @@ public:
 
 #pragma endregion Cross-Stage Communication API
 
+#pragma region Streaming Scheduler API
+	//----------------------------------------------------------------
+	// Streaming Scheduler API - Budgets Stage DataLayer loads and activations
+	//----------------------------------------------------------------
+
+	/**
+	 * @brief Request a load slot for a Stage entering Preloading.
+	 *
+	 * If the scheduler is disabled (see UStageStreamingSettings) or this is not a game
+	 * world, the Stage starts loading immediately. Otherwise the request is queued and
+	 * dispatched once fewer than MaxConcurrentStageLoads Stages are streaming in,
+	 * ordered by Stage StreamingPriority, then by distance to the instigator.
+	 *
+	 * @param Stage - The Stage requesting a load
+	 * @param Instigator - The actor that triggered the load (may be nullptr)
+	 */
+	void RequestStageLoad(AStage* Stage, AActor* Instigator);
+
+	/**
+	 * @brief Release a Stage's load request or slot (load finished, timed out or cancelled).
+	 * @param Stage - The Stage leaving Preloading
+	 */
+	void ReleaseStageLoad(AStage* Stage);
+
+	/**
+	 * @brief Request a Loaded Stage be activated within the per-frame activation budget.
+	 *
+	 * @param Stage - The Stage requesting activation
+	 * @param Instigator - The actor that triggered the activation (may be nullptr)
+	 */
+	void RequestStageActivation(AStage* Stage, AActor* Instigator);
+
+	/**
+	 * @brief Drop a pending activation request (Stage left Loaded by another path).
+	 * @param Stage - The Stage to remove from the activation queue
+	 */
+	void CancelStageActivation(AStage* Stage);
+
+	/** @brief Number of Stages waiting for a load slot. */
+	int32 GetPendingStageLoadCount() const { return PendingLoadRequests.Num(); }
+
+	/** @brief Number of Stages currently streaming in. */
+	int32 GetInFlightStageLoadCount() const { return InFlightLoads.Num(); }
+
+	/** @brief Number of Stages waiting for activation budget. */
+	int32 GetPendingStageActivationCount() const { return PendingActivationRequests.Num(); }
+
+#pragma endregion Streaming Scheduler API
+
+#pragma region Proximity Streaming API
+	//----------------------------------------------------------------
+	// Proximity Streaming API - Overlap-free zone evaluation (opt-in)
+	//----------------------------------------------------------------
+
+	/**
+	 * @brief True when Stage trigger zones are evaluated by the subsystem instead of physics overlaps.
+	 * Requires a game world and UStageStreamingSettings::bEnableProximityStreaming.
+	 */
+	bool IsProximityStreamingActive() const;
+
+	/**
+	 * @brief True when Stage-bound trigger zones are kept in the spatial hash.
+	 * Shared by proximity streaming (enter/exit) and predictive preload (path queries).
+	 */
+	bool IsProximityGridActive() const { return IsProximityStreamingActive() || IsPredictivePreloadActive(); }
+
+	/**
+	 * @brief Add a Stage-bound trigger zone to the spatial hash.
+	 * In proximity streaming mode its physics collision is also disabled.
+	 * Zones are assumed static; re-register after moving one.
+	 * @param Zone - The zone to evaluate by proximity
+	 */
+	void RegisterProximityZone(UStageTriggerZoneComponent* Zone);
+
+	/**
+	 * @brief Remove a trigger zone from the spatial hash.
+	 * @param Zone - The zone to remove
+	 */
+	void UnregisterProximityZone(UStageTriggerZoneComponent* Zone);
+
+	/**
+	 * @brief Track an actor as a streaming source (in addition to player pawns).
+	 * @param Source - Actor whose location drives zone enter/exit
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stage Manager|Streaming")
+	void RegisterStreamingSource(AActor* Source);
+
+	/**
+	 * @brief Stop tracking a streaming source. Zones it was inside receive an exit.
+	 * @param Source - The actor to stop tracking
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stage Manager|Streaming")
+	void UnregisterStreamingSource(AActor* Source);
+
+	/** @brief Number of zones currently in the spatial hash. */
+	int32 GetProximityZoneCount() const { return ProximityZoneBounds.Num(); }
+
+#pragma endregion Proximity Streaming API
+
+#pragma region Predictive Preload API
+	//----------------------------------------------------------------
+	// Predictive Preload API - Velocity extrapolation + load metrics
+	//----------------------------------------------------------------
+
+	/** @brief True when predictive preloading runs (game world + UStageStreamingSettings::bEnablePredictivePreload). */
+	bool IsPredictivePreloadActive() const;
+
+	/**
+	 * @brief Record what started a Stage load, for predicted vs. reactive metrics.
+	 * @param bPredicted - True if started by velocity prediction, false if by a LoadZone entry
+	 */
+	void RecordStageLoadTrigger(bool bPredicted);
+
+	/** @brief Loads started by velocity prediction. */
+	UFUNCTION(BlueprintCallable, Category = "Stage Manager|Streaming")
+	int32 GetPredictedStageLoadCount() const { return PredictedStageLoadCount; }
+
+	/** @brief Loads started by a LoadZone entry (prediction missed or disabled). */
+	UFUNCTION(BlueprintCallable, Category = "Stage Manager|Streaming")
+	int32 GetReactiveStageLoadCount() const { return ReactiveStageLoadCount; }
+
+	/** @brief Predicted loads that expired without anyone entering the LoadZone. */
+	UFUNCTION(BlueprintCallable, Category = "Stage Manager|Streaming")
+	int32 GetExpiredPredictiveLoadCount() const { return ExpiredPredictiveLoadCount; }
+
+	/** @brief Record an unload cycle avoided by Stage unload hysteresis. */
+	void RecordAvoidedUnload() { AvoidedUnloadCount++; }
+
+	/** @brief Unload cycles avoided by hysteresis across all Stages. */
+	UFUNCTION(BlueprintCallable, Category = "Stage Manager|Streaming")
+	int32 GetAvoidedUnloadCount() const { return AvoidedUnloadCount; }
+
+	/** @brief Reset streaming metrics counters. */
+	UFUNCTION(BlueprintCallable, Category = "Stage Manager|Streaming")
+	void ResetStreamingStats();
+
+#pragma endregion Predictive Preload API
+
 #pragma region DataLayer Sync API
 	//----------------------------------------------------------------
 	// DataLayer Sync API - Reverse lookup methods for DataLayer integration
@@ -288,6 +455,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stage Manager|DataLayerSync")
 	int32 FindActIDByDataLayer(AStage* Stage, class UDataLayerAsset* DataLayerAsset) const;
 
+	/**
+	 * @brief Re-index a Stage's DataLayer assignments (Stage root + every Act).
+	 *
+	 * Called by AStage when Acts are added/removed or DataLayers reassigned, and by
+	 * BroadcastStageDataChanged. Unregistered Stages are ignored.
+	 *
+	 * @param Stage - The Stage whose DataLayers changed
+	 */
+	void RefreshStageDataLayerIndex(AStage* Stage);
+
 #pragma endregion DataLayer Sync API
 
 #pragma region Debug Watch API
@@ -346,6 +523,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Stage Manager|Debug")
 	TArray<int32> GetWatchedStageIDs() const;
 
+	/** @brief Watched Stage IDs without copying (for per-frame consumers such as AStageDebugHUD). */
+	const TSet<int32>& GetWatchedStageIDSet() const { return WatchedStageIDs; }
+
 	/**
 	 * @brief Get the number of watched Stages.
 	 * @return Count of watched Stages
@@ -362,6 +542,24 @@ public:
 
 #pragma endregion Debug Watch API
 
+#pragma region Timeline Recorder API
+	//----------------------------------------------------------------
+	// Timeline Recorder API - Stage event capture for hitch analysis
+	//----------------------------------------------------------------
+
+	/** @brief Ring-buffer recorder for zone, state, Act and DataLayer events (see Stage.Record). */
+	FStageTimelineRecorder& GetTimelineRecorder() { return TimelineRecorder; }
+	const FStageTimelineRecorder& GetTimelineRecorder() const { return TimelineRecorder; }
+
+	/**
+	 * @brief Writes the recorded timeline (with Stage names) to a capture file.
+	 * @param Filename - Target path; empty = Saved/Profiling/StageRecordings/StageTimeline_<timestamp>.stagerec
+	 * @return The written path, or an empty string on failure
+	 */
+	FString DumpTimeline(const FString& Filename = FString()) const;
+
+#pragma endregion Timeline Recorder API
+
 private:
 #pragma region Internal State
 	//----------------------------------------------------------------
@@ -392,6 +590,66 @@ private:
 	 * Use Watch/Unwatch API to manage this list.
 	 */
 	TSet<int32> WatchedStageIDs;
+
+	/** Stage event recorder (idle until Stage.Record Start). */
+	FStageTimelineRecorder TimelineRecorder;
+
+	/** Stages in Preloading waiting for a load slot. */
+	TArray<FStageStreamingRequest> PendingLoadRequests;
+
+	/** Stages that were granted a load slot and are streaming in. */
+	TSet<TWeakObjectPtr<AStage>> InFlightLoads;
+
+	/** Loaded Stages waiting for activation budget. */
+	TArray<FStageStreamingRequest> PendingActivationRequests;
+
+	/** True while a next-tick ProcessStreamingQueue is scheduled. */
+	bool bStreamingQueueScheduled = false;
+
+	/** Cell size (cm) the proximity grid was built with. */
+	float ProximityCellSize = 10000.0f;
+
+	/** Spatial hash: XY cell → zones whose bounds overlap that cell. */
+	TMap<FIntPoint, TArray<TWeakObjectPtr<UStageTriggerZoneComponent>>> ProximityGrid;
+
+	/** Cell count above which a zone (or predicted path) is not hashed cell by cell. */
+	static constexpr int64 MaxProximityCellsPerQuery = 256;
+
+	/** Zones too large to hash cell by cell; tested against every source. */
+	TArray<TWeakObjectPtr<UStageTriggerZoneComponent>> OversizedProximityZones;
+
+	/** World bounds each registered zone was hashed with (for removal). */
+	TMap<TWeakObjectPtr<UStageTriggerZoneComponent>, FBox> ProximityZoneBounds;
+
+	/** Explicitly registered streaming sources. */
+	TSet<TWeakObjectPtr<AActor>> StreamingSources;
+
+	/** (Zone, Source) pairs that were inside on the previous evaluation. */
+	TSet<TPair<TWeakObjectPtr<UStageTriggerZoneComponent>, TWeakObjectPtr<AActor>>> ProximityInsidePairs;
+
+	/** Fixed-rate proximity evaluation timer. */
+	FTimerHandle ProximityTimerHandle;
+
+	/** Fixed-rate predictive preload evaluation timer. */
+	FTimerHandle PredictiveTimerHandle;
+
+	/** Stages held loaded by a prediction → world time the prediction last held. */
+	TMap<TWeakObjectPtr<AStage>, double> PredictedStageHitTimes;
+
+	/** Streaming metrics (see Predictive Preload API). */
+	int32 PredictedStageLoadCount = 0;
+	int32 ReactiveStageLoadCount = 0;
+	int32 ExpiredPredictiveLoadCount = 0;
+	int32 AvoidedUnloadCount = 0;
+
+	/**
+	 * Reverse lookup: DataLayerAsset → owning (StageID, ActID).
+	 * Entries are validated on lookup; a stale hit triggers a single full rebuild.
+	 */
+	mutable TMap<TObjectKey<UDataLayerAsset>, FStageDataLayerOwner> DataLayerOwnerIndex;
+
+	/** StageID → DataLayerAssets indexed for it (for per-Stage removal). */
+	mutable TMap<int32, TArray<TObjectKey<UDataLayerAsset>>> IndexedDataLayersByStageID;
 #pragma endregion Internal State
 
 #pragma region Internal Methods
@@ -422,5 +680,51 @@ private:
 	 * the subsystem was created.
 	 */
 	void ScanWorldForExistingStages();
+
+	/** @brief True if load/activation requests should go through the queues (game world + enabled). */
+	bool IsStreamingSchedulerActive() const;
+
+	/** @brief Schedule ProcessStreamingQueue for the next tick (requests made in the same frame are ordered together). */
+	void ScheduleStreamingQueue();
+
+	/**
+	 * @brief Dispatch queued loads up to the concurrency limit and activations up to the per-frame budget.
+	 * Reschedules itself for the next tick while work remains.
+	 */
+	void ProcessStreamingQueue();
+
+	/** @brief Add a Stage's root and Act DataLayers to the reverse index under StageID. */
+	void IndexStageDataLayers(int32 StageID, AStage* Stage) const;
+
+	/** @brief Remove all reverse index entries owned by StageID. */
+	void RemoveStageFromDataLayerIndex(int32 StageID) const;
+
+	/** @brief Rebuild the reverse index from the whole StageRegistry. */
+	void RebuildDataLayerIndex() const;
+
+	/** @brief Check that an index entry still matches the Stage data it points at. */
+	bool IsDataLayerOwnerValid(const UDataLayerAsset* DataLayerAsset, const FStageDataLayerOwner& Owner) const;
+
+	/** @brief Collect registered streaming sources plus (optionally) player pawns. Prunes dead sources. */
+	void GatherStreamingSources(TArray<AActor*, TInlineAllocator<8>>& OutSources);
+
+	/**
+	 * @brief Extrapolate sources along their velocity, start Preloading for Unloaded Stages whose
+	 * LoadZone the predicted path crosses, and expire predictions that no longer hold.
+	 * Only LoadZones hashed into the grid cells under the predicted path (plus oversized zones) are tested.
+	 */
+	void UpdatePredictivePreload();
+
+	/** @brief Compute the XY cell range covered by a world box. */
+	void GetProximityCellRange(const FBox& Bounds, FIntPoint& OutMin, FIntPoint& OutMax) const;
+
+	/**
+	 * @brief Evaluate every streaming source against nearby zones and fire enter/exit
+	 * for pairs that changed since the previous evaluation.
+	 */
+	void UpdateProximityStreaming();
+
+	/** @brief Sort requests by Stage StreamingPriority (desc), then distance to instigator (asc). */
+	void SortStreamingRequests(TArray<FStageStreamingRequest>& Requests) const;
 #pragma endregion Internal Methods
 };
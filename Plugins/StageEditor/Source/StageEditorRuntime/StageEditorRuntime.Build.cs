@@ -37,6 +37,7 @@ public class StageEditorRuntime : ModuleRules
 				"Slate",
 				"SlateCore",
 				"DeveloperSettings",  // For UStageDebugSettings
+				"TraceLog",           // For Stage trace channel (Unreal Insights)
 				// ... add private dependencies that you statically link with here ...
 			}
 			);